@@ -0,0 +1,81 @@
+/**
+ * batch.h
+ * Copyright 2014-2015 John Lawson
+ *
+ * This program is free software: you can redistribute it and/or modify
+ * it under the terms of the GNU General Public License as published by
+ * the Free Software Foundation, either version 3 of the License, or
+ * (at your option) any later version.
+ *
+ * This program is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ * GNU General Public License for more details.
+ *
+ * You should have received a copy of the GNU General Public License
+ * along with this program.  If not, see <http://www.gnu.org/licenses/>.
+ */
+/**
+ * Draw many quivers in a single process.
+ *
+ * Each line of the input is a matrix which is converted to a graph, laid out
+ * and written to its own numbered file, either as GML or as a picture. This
+ * replaces the chain of qv2gml | gmlayout | gml2pic which was previously
+ * started for every line.
+ */
+#pragma once
+
+#include <iostream>
+#include <string>
+
+#include "layout.h"
+#include "layout_cache.h"
+#include "render.h"
+
+namespace qvdraw {
+namespace batch {
+struct Options {
+  /** Directory to write the numbered output files into. */
+  std::string directory = ".";
+  /** Number given to the first drawing. Following drawings count up. */
+  size_t first = 1;
+  /** Size of each vertex in the layout. */
+  int size = 10;
+  qvlayout::Method method = qvlayout::Method::Energy;
+  /** Format of the output files. */
+  render::Format format = render::Format::GML;
+  /** Style of the pictures, if the format is a picture format. */
+  render::Style style;
+  /** Cache of layouts to use, or nullptr to always lay out the quivers. */
+  qvlayout::LayoutCache* cache = nullptr;
+  /** Number of threads used to lay out the quivers. */
+  size_t jobs = 1;
+};
+struct Summary {
+  /** Number of drawings written. */
+  size_t written = 0;
+  /** Number of lines which could not be drawn or written. */
+  size_t failed = 0;
+};
+/**
+ * Name of the file which the drawing with the given number is written to.
+ */
+std::string filename(const Options& opts, size_t number);
+/**
+ * Convert the matrix in the string to a graph, lay it out and write the
+ * result to the output stream in the format given in the options.
+ */
+void draw(const std::string& matrix, const Options& opts, std::ostream& os);
+/**
+ * Draw every matrix read from the input stream, one per line. Blank lines are
+ * skipped, while lines which cannot be drawn are reported on stderr but still
+ * use up a number so that the output numbers match the input lines.
+ *
+ * If more than one job is requested the quivers are laid out concurrently,
+ * but the drawings are still written in the order of their numbers.
+ *
+ * @return The number of drawings written and the number which failed
+ */
+Summary run(std::istream& is, const Options& opts);
+}
+}
@@ -0,0 +1,284 @@
+/*
+ * checkpoint.h
+ * Copyright 2014-2015 John Lawson
+ *
+ * This program is free software: you can redistribute it and/or modify
+ * it under the terms of the GNU General Public License as published by
+ * the Free Software Foundation, either version 3 of the License, or
+ * (at your option) any later version.
+ *
+ * This program is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ * GNU General Public License for more details.
+ *
+ * You should have received a copy of the GNU General Public License
+ * along with this program.  If not, see <http://www.gnu.org/licenses/>.
+ */
+/**
+ * Save the state of an exploration to a file, so that a long exploration can
+ * be carried on after it is stopped, or extended with a larger limit.
+ *
+ * The file is text, starting with the options the graph was explored with and
+ * then with one vertex on each line. Quivers are written in the usual matrix
+ * format, and seeds as their matrix followed by each cluster variable,
+ * separated by tabs. The cluster variables are read back with the
+ * GiNaC parser, using the symbols of the initial seed. G-vector seeds are
+ * written as their matrix, then the matrices of c-vectors and g-vectors.
+ */
+#pragma once
+
+#include <chrono>
+#include <cstdio>
+#include <fstream>
+#include <limits>
+#include <map>
+#include <sstream>
+#include <stdexcept>
+#include <string>
+#include <vector>
+
+#include <ginac/ginac.h>
+
+#include "qv/seed.h"
+
+#include "explore.h"
+#include "graph_factory.h"
+#include "gvector_seed.h"
+#include "trace.h"
+
+namespace qvdraw {
+namespace explore {
+namespace detail {
+const char* const CHECKPOINT_MAGIC = "qvcheckpoint";
+const int CHECKPOINT_VERSION = 3;
+inline void write_node(std::ostream& os, const cluster::IntMatrix& matrix) {
+  os << matrix;
+}
+template <class M>
+void write_node(std::ostream& os, const cluster::__Seed<M>& seed) {
+  os << seed.matrix();
+  for (const GiNaC::ex& var : seed.cluster()) {
+    os << '\t' << var;
+  }
+}
+inline void write_node(std::ostream& os, const GVectorSeed& seed) {
+  os << seed.matrix() << '\t' << seed.c_vectors() << '\t' << seed.g_vectors();
+}
+/* Reads the vertices back, given the initial vertex of the exploration. */
+template <class Node>
+struct NodeReader {
+  explicit NodeReader(const Node& /* ignored */) {}
+  Node operator()(const std::string& line) const { return Node(line); }
+};
+template <class M>
+struct NodeReader<cluster::__Seed<M>> {
+  typedef cluster::__Seed<M> Seed;
+  explicit NodeReader(const Seed& initial) {
+    for (const GiNaC::ex& var : initial.cluster()) {
+      if (GiNaC::is_a<GiNaC::symbol>(var)) {
+        symbols[GiNaC::ex_to<GiNaC::symbol>(var).get_name()] = var;
+      }
+    }
+  }
+  Seed operator()(const std::string& line) const {
+    std::vector<std::string> parts;
+    std::istringstream in(line);
+    std::string part;
+    while (std::getline(in, part, '\t')) {
+      parts.push_back(part);
+    }
+    if (parts.empty()) {
+      throw std::runtime_error("Empty seed in checkpoint");
+    }
+    M matrix(parts[0]);
+    /* Unknown names would become new symbols, so must be errors. */
+    GiNaC::parser reader(symbols, true);
+    typename Seed::Cluster cluster;
+    for (size_t i = 1; i < parts.size(); ++i) {
+      cluster.push_back(reader(parts[i]));
+    }
+    if (cluster.size() != static_cast<size_t>(matrix.num_rows())) {
+      throw std::runtime_error("Seed in checkpoint has the wrong size");
+    }
+    return Seed(matrix, cluster);
+  }
+  GiNaC::symtab symbols;
+};
+template <>
+struct NodeReader<GVectorSeed> {
+  explicit NodeReader(const GVectorSeed& initial) : initial(initial) {}
+  GVectorSeed operator()(const std::string& line) const {
+    std::vector<std::string> parts;
+    std::istringstream in(line);
+    std::string part;
+    while (std::getline(in, part, '\t')) {
+      parts.push_back(part);
+    }
+    if (parts.size() != 3) {
+      throw std::runtime_error("Seed in checkpoint has the wrong size");
+    }
+    return GVectorSeed(initial, cluster::QuiverMatrix(parts[0]),
+                       cluster::IntMatrix(parts[1]),
+                       cluster::IntMatrix(parts[2]));
+  }
+  const GVectorSeed& initial;
+};
+}
+/**
+ * Options which change the graph that is explored, saved in each checkpoint so
+ * that it is only carried on with the same options.
+ */
+struct Flags {
+  /* Which graph was explored: "graph", "move", "exchange" or, with --vectors,
+   * "g-vectors" or "c-vectors". Quiver and move graphs have the same type of
+   * vertex, so could otherwise be carried on as each other. */
+  std::string graph;
+  /* Only mutations which could be in a maximal green sequence, as with -r. */
+  bool green = false;
+  /* The labelled graph, as with -l. */
+  bool labelled = false;
+};
+/**
+ * Write the state to the file. The state is written to a temporary file which
+ * then replaces the old one, so a crash while saving leaves the last
+ * checkpoint as it was.
+ * @throws std::runtime_error if the file cannot be written
+ */
+template <class Node>
+void save(const std::string& path, const State<Node>& state,
+          const Flags& flags) {
+  trace::Scope scope("checkpoint");
+  const std::string temp = path + ".tmp";
+  {
+    std::ofstream os(temp);
+    os << detail::CHECKPOINT_MAGIC << ' ' << detail::CHECKPOINT_VERSION
+       << '\n';
+    os << "graph " << flags.graph << '\n';
+    os << "green " << flags.green << '\n';
+    os << "labelled " << flags.labelled << '\n';
+    os << "nodes " << state.nodes.size() << '\n';
+    for (const Node& node : state.nodes) {
+      detail::write_node(os, node);
+      os << '\n';
+    }
+    os << "edges " << state.edges.size() << '\n';
+    for (const auto& edge : state.edges) {
+      os << edge.first << ' ' << edge.second << '\n';
+    }
+    os << "complete " << state.complete << '\n';
+    os.flush();
+    if (!os) {
+      throw std::runtime_error("Could not write checkpoint " + temp);
+    }
+    trace::count(trace::BytesWritten, os.tellp());
+  }
+  if (std::rename(temp.c_str(), path.c_str()) != 0) {
+    throw std::runtime_error("Could not replace checkpoint " + path);
+  }
+}
+/**
+ * Read the state saved in the file. The first vertex must be the initial
+ * vertex and the flags must be the same as those saved, so that a checkpoint
+ * is not carried on from a different quiver or as a different graph.
+ * @throws std::runtime_error if the file cannot be read or does not match
+ */
+template <class Node>
+State<Node> load(const std::string& path, const Node& initial,
+                 const Flags& flags) {
+  std::ifstream is(path);
+  if (!is) {
+    throw std::runtime_error("Could not open checkpoint " + path);
+  }
+  auto fail = [&path]() {
+    return std::runtime_error(path + " is not a valid checkpoint");
+  };
+  std::string word;
+  int version;
+  if (!(is >> word >> version) || word != detail::CHECKPOINT_MAGIC ||
+      version != detail::CHECKPOINT_VERSION) {
+    throw fail();
+  }
+  std::string graph;
+  bool green;
+  bool labelled;
+  if (!(is >> word >> graph) || word != "graph" ||
+      !(is >> word >> green) || word != "green" ||
+      !(is >> word >> labelled) || word != "labelled") {
+    throw fail();
+  }
+  if (graph != flags.graph) {
+    throw std::runtime_error(path + " is a checkpoint of a " + graph +
+                             " graph, not a " + flags.graph + " graph");
+  }
+  if (green != flags.green || labelled != flags.labelled) {
+    throw std::runtime_error(path + " was explored " +
+                             (green ? "with" : "without") + " -r and " +
+                             (labelled ? "with" : "without") + " -l");
+  }
+  size_t count;
+  if (!(is >> word >> count) || word != "nodes") {
+    throw fail();
+  }
+  is.ignore(std::numeric_limits<std::streamsize>::max(), '\n');
+  State<Node> state;
+  detail::NodeReader<Node> reader(initial);
+  std::string line;
+  for (size_t i = 0; i < count; ++i) {
+    if (!std::getline(is, line)) {
+      throw fail();
+    }
+    state.nodes.push_back(reader(line));
+  }
+  NodeEquals<const Node*> equals;
+  if (state.nodes.empty() || !equals(&state.nodes.front(), &initial)) {
+    throw std::runtime_error(path + " was not explored from this quiver");
+  }
+  if (!(is >> word >> count) || word != "edges") {
+    throw fail();
+  }
+  state.edges.reserve(count);
+  for (size_t i = 0; i < count; ++i) {
+    size_t source;
+    size_t target;
+    if (!(is >> source >> target) || source >= state.nodes.size() ||
+        target >= state.nodes.size()) {
+      throw fail();
+    }
+    state.edges.emplace_back(source, target);
+  }
+  if (!(is >> word >> state.complete) || word != "complete" ||
+      state.complete > state.nodes.size()) {
+    throw fail();
+  }
+  return state;
+}
+/**
+ * Progress callback for resume which saves the state to the file whenever the
+ * interval has passed since it was last saved.
+ */
+template <class Node>
+class Checkpointer {
+ public:
+  Checkpointer(const std::string& path, std::chrono::seconds interval,
+               const Flags& flags)
+      : path_(path),
+        interval_(interval),
+        flags_(flags),
+        last_(std::chrono::steady_clock::now()) {}
+  void operator()(const State<Node>& state, size_t /* ignored */) {
+    auto now = std::chrono::steady_clock::now();
+    if (now - last_ >= interval_) {
+      save(path_, state, flags_);
+      last_ = now;
+    }
+  }
+
+ private:
+  const std::string path_;
+  const std::chrono::seconds interval_;
+  const Flags flags_;
+  std::chrono::steady_clock::time_point last_;
+};
+}
+}
@@ -20,14 +20,34 @@
  */
 #pragma once
 
+#include <string>
 #include <vector>
 
+#include "qv/int_matrix.h"
 #include "qv/mmi_move.h"
 
 namespace qvdraw {
 namespace consts {
 
-extern std::vector<cluster::MMIMove> Moves;
+/** The two quivers exchanged by a move. */
+struct MovePatterns {
+	cluster::IntMatrix a;
+	cluster::IntMatrix b;
+};
+/**
+ * The MMI moves, built from the compiled move table the first time they are
+ * needed.
+ */
+const std::vector<cluster::MMIMove>& moves();
+/** The quivers of each of the moves, in the same order. */
+const std::vector<MovePatterns>& patterns();
+/**
+ * Read extra moves from a file in the same format as data/moves.txt, adding
+ * their quivers to patterns if given.
+ * @throws std::runtime_error if the file cannot be read or is not valid
+ */
+std::vector<cluster::MMIMove> load_moves(const std::string& path,
+		std::vector<MovePatterns>* patterns = nullptr);
 
 }
 }
@@ -0,0 +1,192 @@
+/*
+ * csr_graph.h
+ * Copyright 2014-2015 John Lawson
+ *
+ * This program is free software: you can redistribute it and/or modify
+ * it under the terms of the GNU General Public License as published by
+ * the Free Software Foundation, either version 3 of the License, or
+ * (at your option) any later version.
+ *
+ * This program is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ * GNU General Public License for more details.
+ *
+ * You should have received a copy of the GNU General Public License
+ * along with this program.  If not, see <http://www.gnu.org/licenses/>.
+ */
+/**
+ * Compact form of the quiver and exchange graphs.
+ *
+ * Every vertex is given a number from 0 to size() - 1, and the edges are held
+ * in compressed sparse row form with a single edge for each pair of adjacent
+ * vertices. Links which mutate a vertex back to itself are not edges.
+ *
+ * If every vertex has the same number of links, as in the graphs where vertex
+ * k is joined to the mutation at k, then the links are also kept in a table so
+ * that link(v, k) is the vertex reached by the k-th link from v.
+ */
+#pragma once
+
+#include <algorithm>
+#include <cstdint>
+#include <unordered_map>
+#include <utility>
+#include <vector>
+
+#include "ogdf/basic/Graph_d.h"
+
+#include "graph_factory.h"
+#include "qvb.h"
+#include "trace.h"
+
+namespace qvdraw {
+template <class M>
+class CsrGraph {
+ public:
+  /** Link to a vertex which was not explored. */
+  static constexpr size_t NONE = SIZE_MAX;
+  /**
+   * Convert a libqv graph, or any graph which iterates over pairs of vertex
+   * and links in the same way.
+   *
+   * The links of a libqv graph point at the same objects as the vertices, so
+   * vertices are numbered by their address. Only if a link does not match any
+   * address are the vertices compared by NodeHash and NodeEquals.
+   */
+  template <class G>
+  explicit CsrGraph(const G& graph);
+  /** Number of vertices. */
+  size_t size() const { return nodes_.size(); }
+  /** Number of edges, counting each pair of adjacent vertices once. */
+  size_t num_edges() const { return edges_.size(); }
+  const M* node(size_t id) const { return nodes_[id]; }
+  /** Edges as pairs of vertex numbers, with the smaller number first. */
+  const std::vector<std::pair<size_t, size_t>>& edges() const {
+    return edges_;
+  }
+  /** Neighbours of the vertex are neighbours()[offset(v)] to offset(v + 1). */
+  size_t offset(size_t id) const { return offsets_[id]; }
+  const std::vector<size_t>& neighbours() const { return adjacency_; }
+  /** Whether every vertex has the same number of links, so link() works. */
+  bool indexed() const { return width_ > 0; }
+  /** Number of links from each vertex, if indexed. */
+  size_t width() const { return width_; }
+  /** Vertex reached by the k-th link from the vertex, or NONE. */
+  size_t link(size_t id, size_t k) const { return links_[id * width_ + k]; }
+
+ private:
+  std::vector<const M*> nodes_;
+  std::vector<std::pair<size_t, size_t>> edges_;
+  std::vector<size_t> offsets_;
+  std::vector<size_t> adjacency_;
+  size_t width_;
+  std::vector<size_t> links_;
+};
+template <class M>
+template <class G>
+CsrGraph<M>::CsrGraph(const G& graph) : width_(0) {
+  trace::Scope scope("csr graph");
+  std::unordered_map<const M*, size_t> ids;
+  for (auto it = graph.begin(); it != graph.end(); ++it) {
+    ids.emplace(it->first, nodes_.size());
+    nodes_.push_back(it->first);
+  }
+  /* Only built if a link is not the address of a vertex. */
+  NodeKeyMap<const M*, size_t> deep;
+  auto id_of = [&](const M* node) -> size_t {
+    if (node == nullptr) {
+      return NONE;
+    }
+    auto found = ids.find(node);
+    if (found != ids.end()) {
+      return found->second;
+    }
+    if (deep.empty()) {
+      for (size_t i = 0; i < nodes_.size(); ++i) {
+        deep.emplace(NodeKey<const M*>(nodes_[i]), i);
+      }
+    }
+    auto equal = deep.find(NodeKey<const M*>(node));
+    return equal != deep.end() ? equal->second : NONE;
+  };
+
+  bool uniform = true;
+  size_t width = 0;
+  for (auto it = graph.begin(); it != graph.end(); ++it) {
+    size_t count = it->second.size();
+    if (it == graph.begin()) {
+      width = count;
+    } else if (count != width) {
+      uniform = false;
+    }
+  }
+  if (uniform && width > 0) {
+    width_ = width;
+    links_.assign(nodes_.size() * width_, NONE);
+  }
+  size_t source = 0;
+  for (auto it = graph.begin(); it != graph.end(); ++it, ++source) {
+    size_t k = 0;
+    for (auto link = it->second.begin(); link != it->second.end();
+         ++link, ++k) {
+      size_t target = id_of(*link);
+      if (width_ > 0) {
+        links_[source * width_ + k] = target;
+      }
+      if (target != NONE && target != source) {
+        edges_.emplace_back(std::min(source, target),
+                            std::max(source, target));
+      }
+    }
+  }
+  std::sort(edges_.begin(), edges_.end());
+  edges_.erase(std::unique(edges_.begin(), edges_.end()), edges_.end());
+
+  offsets_.assign(nodes_.size() + 1, 0);
+  for (const auto& edge : edges_) {
+    ++offsets_[edge.first + 1];
+    ++offsets_[edge.second + 1];
+  }
+  for (size_t i = 0; i < nodes_.size(); ++i) {
+    offsets_[i + 1] += offsets_[i];
+  }
+  trace::count(trace::Nodes, nodes_.size());
+  trace::count(trace::Edges, edges_.size());
+  adjacency_.resize(offsets_.back());
+  std::vector<size_t> fill(offsets_.begin(), offsets_.end() - 1);
+  for (const auto& edge : edges_) {
+    adjacency_[fill[edge.first]++] = edge.second;
+    adjacency_[fill[edge.second]++] = edge.first;
+  }
+}
+/**
+ * Add the vertices and edges of the graph to an empty ogdf::Graph, so that the
+ * index of each ogdf node is the number of its vertex.
+ */
+template <class M>
+void ogdf_graph(const CsrGraph<M>& csr, ogdf::Graph& graph) {
+  std::vector<ogdf::node> nodes(csr.size());
+  for (size_t i = 0; i < csr.size(); ++i) {
+    nodes[i] = graph.newNode();
+  }
+  for (const auto& edge : csr.edges()) {
+    graph.newEdge(nodes[edge.first], nodes[edge.second]);
+  }
+}
+/**
+ * Collect the vertices, along with their quivers, and the edges of the graph
+ * to be written as a .qvb file.
+ */
+template <class M>
+qvb::Builder binary(const CsrGraph<M>& csr) {
+  qvb::Builder result;
+  for (size_t i = 0; i < csr.size(); ++i) {
+    result.add_node(*csr.node(i));
+  }
+  for (const auto& edge : csr.edges()) {
+    result.add_edge(edge.first, edge.second);
+  }
+  return result;
+}
+}
@@ -0,0 +1,45 @@
+/*
+ * dynkin_layout.h
+ * Copyright 2014-2015 John Lawson
+ *
+ * This program is free software: you can redistribute it and/or modify
+ * it under the terms of the GNU General Public License as published by
+ * the Free Software Foundation, either version 3 of the License, or
+ * (at your option) any later version.
+ *
+ * This program is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ * GNU General Public License for more details.
+ *
+ * You should have received a copy of the GNU General Public License
+ * along with this program.  If not, see <http://www.gnu.org/licenses/>.
+ */
+/**
+ * Fixed layouts for quivers whose underlying graph is a Dynkin diagram of type
+ * A, D or E or one of their affine versions, which have well known drawings
+ * and so do not need a force directed layout.
+ *
+ * Only the shape of the underlying graph is used, so any orientation of the
+ * arrows is recognised and the weights of the arrows are ignored.
+ */
+#pragma once
+
+#include <utility>
+#include <vector>
+
+#include "qv/int_matrix.h"
+
+namespace qvlayout {
+/**
+ * Positions of the vertices of the quiver if it is a Dynkin or affine diagram,
+ * such that coords[i] is the position of vertex i. Edges are size * 2 long,
+ * so nodes of the given size are drawn one node apart.
+ *
+ * Type A is drawn in a line and affine A as a regular polygon. The other types
+ * are drawn with their two longest arms in a line and the rest pointing up.
+ * @return false, leaving coords unchanged, if the quiver is not of these types
+ */
+bool dynkin_layout(const cluster::IntMatrix& matrix, int size,
+                   std::vector<std::pair<double, double>>& coords);
+}
@@ -0,0 +1,376 @@
+/*
+ * explore.h
+ * Copyright 2014-2015 John Lawson
+ *
+ * This program is free software: you can redistribute it and/or modify
+ * it under the terms of the GNU General Public License as published by
+ * the Free Software Foundation, either version 3 of the License, or
+ * (at your option) any later version.
+ *
+ * This program is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ * GNU General Public License for more details.
+ *
+ * You should have received a copy of the GNU General Public License
+ * along with this program.  If not, see <http://www.gnu.org/licenses/>.
+ */
+/**
+ * Breadth first exploration of quiver and exchange graphs, which reports each
+ * vertex and edge to a visitor as soon as it is found.
+ *
+ * The libqv graphs hold every vertex along with all of its links, and have to
+ * be converted into an ogdf::Graph before anything can be written. Here only
+ * the vertices themselves are kept, to recognise when one is found again, so
+ * output can start straight away and the links are never stored.
+ */
+#pragma once
+
+#include <algorithm>
+#include <cstdint>
+#include <deque>
+#include <iostream>
+#include <set>
+#include <sstream>
+#include <string>
+#include <type_traits>
+#include <unordered_map>
+#include <utility>
+#include <vector>
+
+#include "ogdf/basic/Graph_d.h"
+
+#include "qv/green_exchange_graph.h"
+#include "qv/mmi_move.h"
+#include "qv/seed.h"
+
+#include "graph_factory.h"
+#include "gvector_seed.h"
+#include "move_index.h"
+#include "trace.h"
+
+namespace qvdraw {
+namespace explore {
+/* Number of vertices which can be mutated at. */
+inline size_t vertices(const cluster::IntMatrix& matrix) {
+  return matrix.num_rows();
+}
+template <class M>
+size_t vertices(const cluster::__Seed<M>& seed) {
+  return seed.size();
+}
+inline size_t vertices(const GVectorSeed& seed) { return seed.size(); }
+/* Whether mutating at k might be part of a maximal green sequence. */
+template <class M>
+bool may_be_green(const cluster::green_exchange::MultiArrowTriangleCheck& chk,
+                  const M& node, size_t k) {
+  return chk(&node, k);
+}
+inline bool may_be_green(
+    const cluster::green_exchange::MultiArrowTriangleCheck& chk,
+    const GVectorSeed& seed, size_t k) {
+  return chk(&seed.matrix(), k);
+}
+/**
+ * Neighbours of a quiver or seed found by mutating at each vertex. If green is
+ * set then only the mutations which could appear in a maximal green sequence
+ * are followed, as in the libqv green graphs.
+ */
+template <class M>
+class MutationStep {
+ public:
+  explicit MutationStep(bool green = false) : green_(green) {}
+  template <class F>
+  void operator()(const M& node, F&& f) const {
+    const size_t size = vertices(node);
+    for (size_t k = 0; k < size; ++k) {
+      if (green_ && !may_be_green(chk_, node, k)) {
+        continue;
+      }
+      M result(node);
+      node.mutate(k, result);
+      f(std::move(result));
+    }
+  }
+
+ private:
+  const bool green_;
+  cluster::green_exchange::MultiArrowTriangleCheck chk_;
+};
+/**
+ * Neighbours of a quiver found by applying each of the MMI moves. If an index
+ * of the moves is given then only the moves it picks out for each quiver are
+ * tried.
+ */
+template <class M>
+class MoveStep {
+ public:
+  explicit MoveStep(const std::vector<cluster::MMIMove>& moves,
+                    const MoveIndex* index = nullptr)
+      : moves_(moves), index_(index) {}
+  template <class F>
+  void operator()(const M& node, F&& f) const {
+    if (index_ == nullptr) {
+      for (const cluster::MMIMove& move : moves_) {
+        apply(move, node, f);
+      }
+      return;
+    }
+    for (size_t i : index_->candidates(node)) {
+      apply(moves_[i], node, f);
+    }
+  }
+
+ private:
+  const std::vector<cluster::MMIMove>& moves_;
+  const MoveIndex* const index_;
+  template <class F>
+  static void apply(const cluster::MMIMove& move, const M& node, F& f) {
+    for (const auto& app : move.applicable_submatrices(node)) {
+      M result(node);
+      move.move(app, result);
+      f(std::move(result));
+    }
+  }
+};
+/**
+ * Whether the step finds every link again from the other end, so that an edge
+ * to a vertex which has already been explored was reported from there.
+ * Mutation is its own inverse, but the inverse of an MMI move need not be in
+ * the set of moves.
+ */
+template <class Step>
+struct symmetric : std::false_type {};
+template <class M>
+struct symmetric<MutationStep<M>> : std::true_type {};
+/**
+ * Progress of an exploration, from which it can be carried on later. The
+ * vertices are held in the order they were found, and the edges in the order
+ * they were reported, as the vertex being explored and its neighbour.
+ */
+template <class Node>
+struct State {
+  State() = default;
+  explicit State(const Node& initial) { nodes.push_back(initial); }
+  std::deque<Node> nodes;
+  std::vector<std::pair<size_t, size_t>> edges;
+  /* Number of vertices, from the first, which have been explored without any
+   * neighbours being dropped because of the limit. */
+  size_t complete = 0;
+  /* Whether to store the edges, which are only needed to carry on later. */
+  bool keep_edges = true;
+};
+/* Progress callback which does nothing. */
+struct NoProgress {
+  template <class Node>
+  void operator()(const State<Node>& /* ignored */, size_t /* ignored */) {}
+};
+/**
+ * Carry on exploring from the state, taking the neighbours of each vertex from
+ * the step. The vertices and edges already in the state are first passed to
+ * the visitor, then exploration continues as in explore below.
+ *
+ * Vertices which were not completely explored, either because the previous
+ * run was stopped or because their neighbours were dropped by the limit, are
+ * explored again, so their edges are removed from the state and found again.
+ * The result is the same as exploring from the start with the new limit, as
+ * long as the state holds no more vertices than that limit.
+ *
+ * After each vertex is explored progress(state, explored) is called with the
+ * number of vertices explored so far.
+ */
+template <class Node, class Step, class Visitor, class Progress>
+void resume(State<Node>& state, const Step& step, Visitor& visitor,
+            size_t limit, Progress&& progress) {
+  trace::Scope scope("explore");
+  std::deque<Node>& nodes = state.nodes;
+  /* Each key keeps the hash and fingerprints of its vertex, so they are only
+   * worked out once for each neighbour found. */
+  NodeKeyMap<const Node*, size_t> ids;
+  for (size_t i = 0; i < nodes.size(); ++i) {
+    ids.emplace(NodeKey<const Node*>(&nodes[i]), i);
+    visitor.node(i, nodes[i]);
+  }
+  trace::count(trace::Nodes, nodes.size());
+  const size_t complete = state.complete;
+  auto found_again = [complete](const std::pair<size_t, size_t>& edge) {
+    return edge.first >= complete;
+  };
+  state.edges.erase(std::remove_if(state.edges.begin(), state.edges.end(),
+                                   found_again),
+                    state.edges.end());
+  /* Edges reported to vertices found later, kept for steps which are not
+   * symmetric to tell whether a link back to an earlier vertex is new. */
+  std::set<std::pair<size_t, size_t>> reported;
+  for (const auto& edge : state.edges) {
+    visitor.edge(edge.first, edge.second);
+    if (!symmetric<Step>::value && edge.first < edge.second) {
+      reported.insert(edge);
+    }
+  }
+  trace::count(trace::Edges, state.edges.size());
+  /* Vertices already joined to the one being explored, as in CsrGraph each
+   * pair of vertices has at most one edge. */
+  std::vector<size_t> targets;
+  for (size_t next = complete; next < nodes.size(); ++next) {
+    bool dropped = false;
+    targets.clear();
+    step(nodes[next], [&](Node&& neighbour) {
+      size_t id;
+      NodeKey<const Node*> key(&neighbour);
+      auto found = ids.find(key);
+      if (found != ids.end()) {
+        id = found->second;
+        if (id < next && (symmetric<Step>::value ||
+                          reported.count(std::make_pair(id, next)) != 0)) {
+          /* Already reported when that vertex was explored. */
+          return;
+        }
+      } else if (nodes.size() < limit) {
+        id = nodes.size();
+        nodes.push_back(std::move(neighbour));
+        key.node = &nodes.back();
+        ids.emplace(std::move(key), id);
+        visitor.node(id, nodes.back());
+        trace::count(trace::Nodes);
+      } else {
+        dropped = true;
+        return;
+      }
+      if (id == next ||
+          std::find(targets.begin(), targets.end(), id) != targets.end()) {
+        /* A link to itself, or another link to the same vertex. */
+        return;
+      }
+      targets.push_back(id);
+      visitor.edge(next, id);
+      trace::count(trace::Edges);
+      if (!symmetric<Step>::value && next < id) {
+        reported.emplace(next, id);
+      }
+      if (state.keep_edges) {
+        state.edges.emplace_back(next, id);
+      }
+    });
+    if (!dropped && state.complete == next) {
+      state.complete = next + 1;
+    }
+    progress(state, next + 1);
+  }
+}
+/**
+ * Explore the graph from the initial vertex, taking the neighbours of each
+ * vertex from the step. Vertices are numbered in the order they are found,
+ * starting from 0 for the initial vertex.
+ *
+ * The visitor is called with node(id, vertex) for each new vertex, and
+ * edge(source, target) for each edge, after both ends have been passed to
+ * node. Each edge is reported once, from the end which is explored first,
+ * unless the step is not symmetric and only finds it from the other end. Links
+ * from a vertex to itself are dropped, and several links between the same
+ * two vertices give a single edge, as in CsrGraph.
+ *
+ * No more than limit vertices are found, and any edges to further vertices
+ * are dropped. The vertices are returned, indexed by their number.
+ */
+template <class M, class Step, class Visitor>
+std::deque<typename std::remove_const<M>::type> explore(
+    const M& initial,
+    const Step& step,
+    Visitor& visitor,
+    size_t limit = SIZE_MAX) {
+  typedef typename std::remove_const<M>::type Node;
+  if (limit == 0) {
+    return std::deque<Node>();
+  }
+  State<Node> state(initial);
+  state.keep_edges = false;
+  resume(state, step, visitor, limit, NoProgress());
+  return std::move(state.nodes);
+}
+/**
+ * Write the graph in GML as it is explored. Each node is labelled with its
+ * quiver or seed. The output is flushed every so often, so a partial graph is
+ * available while a long exploration is running, and end() must be called
+ * once the exploration is finished to complete the file.
+ */
+class GmlWriter {
+ public:
+  /** Number of nodes written between each flush of the stream. */
+  static const size_t FLUSH_EVERY = 1024;
+  explicit GmlWriter(std::ostream& os) : os_(os) {
+    /* The same header as gml::write, so the graphs are read the same way. */
+    os_ << "Creator \"qvdraw\"" << os_.widen('\n');
+    os_ << "directed 1" << os_.widen('\n');
+    os_ << "graph [" << os_.widen('\n');
+  }
+  template <class M>
+  void node(size_t id, const M& vertex) {
+    std::ostringstream label;
+    label << vertex;
+    os_ << "  node [" << os_.widen('\n');
+    os_ << "    id " << id << os_.widen('\n');
+    os_ << "    label \"" << label.str() << '"' << os_.widen('\n');
+    os_ << "  ]" << os_.widen('\n');
+    if (id % FLUSH_EVERY == 0) {
+      os_.flush();
+    }
+  }
+  void edge(size_t source, size_t target) {
+    os_ << "  edge [" << os_.widen('\n');
+    os_ << "    source " << source << os_.widen('\n');
+    os_ << "    target " << target << os_.widen('\n');
+    os_ << "  ]" << os_.widen('\n');
+  }
+  void end() {
+    os_ << "]" << os_.widen('\n');
+    os_.flush();
+  }
+
+ private:
+  std::ostream& os_;
+};
+/**
+ * Write the graph as a list of edges, one "source target" pair of node
+ * numbers on each line.
+ */
+class EdgeListWriter {
+ public:
+  static const size_t FLUSH_EVERY = 1024;
+  explicit EdgeListWriter(std::ostream& os) : os_(os) {}
+  template <class M>
+  void node(size_t id, const M& /* ignored */) {
+    if (id % FLUSH_EVERY == 0) {
+      os_.flush();
+    }
+  }
+  void edge(size_t source, size_t target) {
+    os_ << source << ' ' << target << os_.widen('\n');
+  }
+  void end() { os_.flush(); }
+
+ private:
+  std::ostream& os_;
+};
+/**
+ * Build an ogdf::Graph of the exploration, without keeping any other copy of
+ * the links. The graph is empty to begin with, so the index of each ogdf node
+ * is the number of the vertex it represents.
+ */
+class GraphBuilder {
+ public:
+  explicit GraphBuilder(ogdf::Graph& graph) : graph_(graph) {}
+  template <class M>
+  void node(size_t /* ignored */, const M& /* ignored */) {
+    nodes_.push_back(graph_.newNode());
+  }
+  void edge(size_t source, size_t target) {
+    graph_.newEdge(nodes_[source], nodes_[target]);
+  }
+
+ private:
+  ogdf::Graph& graph_;
+  std::vector<ogdf::node> nodes_;
+};
+}
+}
@@ -0,0 +1,49 @@
+/*
+ * fingerprint.h
+ * Copyright 2014-2015 John Lawson
+ *
+ * This program is free software: you can redistribute it and/or modify
+ * it under the terms of the GNU General Public License as published by
+ * the Free Software Foundation, either version 3 of the License, or
+ * (at your option) any later version.
+ *
+ * This program is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ * GNU General Public License for more details.
+ *
+ * You should have received a copy of the GNU General Public License
+ * along with this program.  If not, see <http://www.gnu.org/licenses/>.
+ */
+/**
+ * Fingerprints of cluster variables, found by evaluating them at fixed random
+ * points modulo the prime 2^61 - 1.
+ *
+ * Equal rational functions always have the same fingerprint, so seeds whose
+ * fingerprints differ are known to be different without comparing their
+ * GiNaC expressions. Different functions only share a fingerprint if each
+ * point happens to be a root of their difference, which is very unlikely, but
+ * a match still has to be checked symbolically to be sure.
+ */
+#pragma once
+
+#include <array>
+#include <cstdint>
+
+#include <ginac/ginac.h>
+
+namespace qvdraw {
+namespace fingerprint {
+/* Number of points each expression is evaluated at. */
+const size_t POINTS = 2;
+typedef std::array<uint64_t, POINTS> Value;
+/**
+ * Evaluate the expression at each of the points. Each symbol takes a value
+ * chosen from its name, so the same symbol has the same value in every
+ * expression and every run.
+ * @return false if the expression is not a rational function with rational
+ * coefficients, or if a denominator is zero at one of the points
+ */
+bool evaluate(const GiNaC::ex& exp, Value& result);
+}
+}
@@ -0,0 +1,56 @@
+/*
+ * gml.h
+ * Copyright 2014-2015 John Lawson
+ *
+ * This program is free software: you can redistribute it and/or modify
+ * it under the terms of the GNU General Public License as published by
+ * the Free Software Foundation, either version 3 of the License, or
+ * (at your option) any later version.
+ *
+ * This program is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ * GNU General Public License for more details.
+ *
+ * You should have received a copy of the GNU General Public License
+ * along with this program.  If not, see <http://www.gnu.org/licenses/>.
+ */
+/**
+ * Write quivers and graphs as GML or GraphML without building an ogdf::Graph.
+ *
+ * The GML follows the layout of the OGDF writers, so the files can be read
+ * back by gmlayout and any other program which reads the OGDF output.
+ */
+#pragma once
+
+#include <iostream>
+#include <string>
+#include <utility>
+#include <vector>
+
+#include "qv/int_matrix.h"
+
+namespace qvdraw {
+namespace gml {
+enum class Format { GML, GraphML };
+/**
+ * Label of the edge i -> j in the graph of the quiver. Single arrows have no
+ * label, multiple arrows are labelled with their weight and arrows which are
+ * not skew-symmetric with the pair of weights.
+ */
+std::string edge_label(const cluster::IntMatrix& matrix, int i, int j);
+/**
+ * Write the graph of the quiver, with one node for each vertex and one labelled
+ * edge for each arrow, as graph_factory::graph would construct it.
+ */
+void write(std::ostream& os, const cluster::IntMatrix& matrix,
+           Format format = Format::GML);
+/**
+ * Write a graph with the given number of nodes, numbered from 0, and edges
+ * given as pairs of node numbers.
+ */
+void write(std::ostream& os, size_t nodes,
+           const std::vector<std::pair<size_t, size_t>>& edges,
+           Format format = Format::GML);
+}
+}
@@ -22,6 +22,7 @@
 
 #include <memory>
 #include <unordered_map>
+#include <vector>
 
 #include "ogdf/basic/Graph_d.h"
 #include "ogdf/basic/GraphAttributes.h"
@@ -31,6 +32,10 @@
 
 #include "qvrefl/cartan_exchange_graph.h"
 
+#include "fingerprint.h"
+#include "gvector_seed.h"
+#include "qvb.h"
+
 namespace qvdraw {
 template <class NodeType>
 struct NodeEquals {
@@ -40,6 +45,47 @@ template <class NodeType>
 struct NodeHash {
   size_t operator()(const NodeType& node) const;
 };
+/**
+ * Vertex used as the key of a map, along with its hash and, for seeds, the
+ * fingerprints of its cluster variables. These are worked out once when the
+ * key is made, rather than every time the map hashes or compares the vertex.
+ */
+template <class NodeType>
+struct NodeKey {
+  explicit NodeKey(NodeType n) : node(n), hash(NodeHash<NodeType>()(n)) {}
+  NodeType node;
+  size_t hash;
+  /* Empty unless every cluster variable of a seed has a fingerprint. */
+  std::vector<fingerprint::Value> prints;
+};
+template <>
+NodeKey<const cluster::Seed*>::NodeKey(const cluster::Seed* n);
+template <>
+NodeKey<const cluster::LabelledSeed*>::NodeKey(const cluster::LabelledSeed* n);
+template <class NodeType>
+struct NodeKeyHash {
+  size_t operator()(const NodeKey<NodeType>& key) const { return key.hash; }
+};
+template <class NodeType>
+struct NodeKeyEquals {
+  bool operator()(const NodeKey<NodeType>& lhs,
+                  const NodeKey<NodeType>& rhs) const {
+    return NodeEquals<NodeType>()(lhs.node, rhs.node);
+  }
+};
+template <>
+bool NodeKeyEquals<const cluster::Seed*>::operator()(
+    const NodeKey<const cluster::Seed*>& lhs,
+    const NodeKey<const cluster::Seed*>& rhs) const;
+template <>
+bool NodeKeyEquals<const cluster::LabelledSeed*>::operator()(
+    const NodeKey<const cluster::LabelledSeed*>& lhs,
+    const NodeKey<const cluster::LabelledSeed*>& rhs) const;
+/* Map from vertices to values, with each key made by NodeKey. */
+template <class NodeType, class Value>
+using NodeKeyMap = std::unordered_map<NodeKey<NodeType>, Value,
+                                      NodeKeyHash<NodeType>,
+                                      NodeKeyEquals<NodeType>>;
 struct ogdfnodeEquals {
   bool operator()(const ogdf::node& lhs, const ogdf::node& rhs) const;
 };
@@ -66,6 +112,28 @@ namespace graph_factory {
  */
 std::pair<std::shared_ptr<ogdf::Graph>, std::shared_ptr<ogdf::GraphAttributes>>
 graph(const cluster::IntMatrix& matrix);
+/**
+ * Recover the matrix of a quiver from its graph, as constructed by graph
+ * above. Edges without a label are taken to be single arrows.
+ */
+cluster::IntMatrix matrix(const ogdf::Graph& graph,
+                          const ogdf::GraphAttributes& attr);
+/**
+ * Construct an OGDF graph from a graph mapped from a .qvb file, along with its
+ * node and edge labels and, if the file has them, the node positions. The
+ * index of each node is its number in the file.
+ */
+std::pair<std::shared_ptr<ogdf::Graph>, std::shared_ptr<ogdf::GraphAttributes>>
+graph(const qvb::MappedGraph& mapped);
+/**
+ * Collect the graph, with any labels and the node positions, to be written as
+ * a .qvb file. If quivers is given it holds the quiver of each node, indexed
+ * by the node index, or null for nodes without one.
+ */
+qvb::Builder binary(
+    const ogdf::Graph& graph,
+    const ogdf::GraphAttributes& attr,
+    const std::vector<const cluster::IntMatrix*>* quivers = nullptr);
 /**
  * Construct an ogdf graph from the given seed. The cluster variables will be
  * assigned to labels on the nodes of the graph.
@@ -73,6 +141,12 @@ graph(const cluster::IntMatrix& matrix);
 template <class M>
 std::pair<std::shared_ptr<ogdf::Graph>, std::shared_ptr<ogdf::GraphAttributes>>
 graph(const cluster::__Seed<M>& seed);
+/**
+ * Construct an ogdf graph from the seed, with each node labelled by its
+ * g-vector or c-vector, whichever the seed was made to show.
+ */
+std::pair<std::shared_ptr<ogdf::Graph>, std::shared_ptr<ogdf::GraphAttributes>>
+graph(const GVectorSeed& seed);
 /**
  * Construct a graph from the CartanQuiver. Edges are labelled with '-' if the
  * corresponding cartan entry is negative.
@@ -80,7 +154,9 @@ graph(const cluster::__Seed<M>& seed);
 std::pair<std::shared_ptr<ogdf::Graph>, std::shared_ptr<ogdf::GraphAttributes>>
 graph(const refl::cartan_exchange::CartanQuiver& seed);
 /**
- * Construct an OGDF graph consisting of the relations between quivers.
+ * Construct an OGDF graph consisting of the relations between quivers, with a
+ * single edge between each pair of related quivers. The index of each node is
+ * the number of the quiver in the CsrGraph of the graph.
  */
 template <class NodeType, class G>
 GraphPair<NodeType> multi_graph(const G& graph);
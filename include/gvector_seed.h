@@ -0,0 +1,96 @@
+/*
+ * gvector_seed.h
+ * Copyright 2014-2015 John Lawson
+ *
+ * This program is free software: you can redistribute it and/or modify
+ * it under the terms of the GNU General Public License as published by
+ * the Free Software Foundation, either version 3 of the License, or
+ * (at your option) any later version.
+ *
+ * This program is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ * GNU General Public License for more details.
+ *
+ * You should have received a copy of the GNU General Public License
+ * along with this program.  If not, see <http://www.gnu.org/licenses/>.
+ */
+/**
+ * Seed of a cluster algebra with principal coefficients, held as its quiver
+ * along with the c-vector and g-vector of each vertex rather than symbolic
+ * cluster variables.
+ *
+ * The g-vectors determine the cluster variables, so two seeds are the same
+ * exactly when their g-vectors are, and mutation only needs integer
+ * arithmetic. The c-vectors are the coefficient rows of the framed quiver and
+ * are needed to mutate the g-vectors, using the formulas of Fomin and
+ * Zelevinsky, Cluster algebras IV, Prop. 6.6.
+ */
+#pragma once
+
+#include <iostream>
+#include <memory>
+#include <string>
+#include <vector>
+
+#include "qv/quiver_matrix.h"
+
+namespace qvdraw {
+class GVectorSeed {
+ public:
+  /** Which vectors are used to label the vertices of the drawn quivers. */
+  enum class Vectors { G, C };
+  /**
+   * Initial seed of the quiver, whose c-vectors and g-vectors are the unit
+   * vectors. If labelled is set then seeds are only the same if their vertices
+   * have the same g-vectors in the same order, as in cluster::LabelledSeed,
+   * otherwise the order does not matter, as in cluster::Seed.
+   */
+  explicit GVectorSeed(const cluster::QuiverMatrix& matrix,
+                       bool labelled = false,
+                       Vectors shown = Vectors::G);
+  /**
+   * Seed found by mutating the initial seed, with the c-vectors and g-vectors
+   * of the vertices as the columns of the matrices.
+   * @throws std::runtime_error if the sizes of the matrices do not match
+   */
+  GVectorSeed(const GVectorSeed& initial,
+              const cluster::QuiverMatrix& matrix,
+              const cluster::IntMatrix& c_vectors,
+              const cluster::IntMatrix& g_vectors);
+  /** Number of vertices, which is also the length of each vector. */
+  size_t size() const { return size_; }
+  const cluster::QuiverMatrix& matrix() const { return matrix_; }
+  /** Whether the order of the vertices matters when comparing seeds. */
+  bool labelled() const { return labelled_; }
+  /** Matrix with the c-vectors as its columns. */
+  cluster::IntMatrix c_vectors() const;
+  /** Matrix with the g-vectors as its columns. */
+  cluster::IntMatrix g_vectors() const;
+  /** Vector of the vertex chosen to be shown, written as (a, b, ...). */
+  std::string label(size_t vertex) const;
+  /**
+   * Mutate the seed at vertex k, storing the result in result, which must be
+   * a copy of a seed from the same initial seed.
+   */
+  void mutate(int k, GVectorSeed& result) const;
+  size_t hash() const { return hash_; }
+  bool equals(const GVectorSeed& other) const;
+  /** Write the quiver then the g-vectors, in the usual matrix format. */
+  friend std::ostream& operator<<(std::ostream& os, const GVectorSeed& seed);
+
+ private:
+  size_t size_;
+  /* Exchange matrix of the initial seed, shared by all seeds found from it. */
+  std::shared_ptr<const cluster::IntMatrix> initial_;
+  cluster::QuiverMatrix matrix_;
+  /* Vectors of vertex k are held in [k * size_, (k + 1) * size_). */
+  std::vector<int> c_;
+  std::vector<int> g_;
+  size_t hash_;
+  bool labelled_;
+  Vectors shown_;
+  const int* g_vector(size_t k) const { return g_.data() + k * size_; }
+  void compute_hash();
+};
+}
@@ -0,0 +1,80 @@
+/*
+ * incremental.h
+ * Copyright 2014-2015 John Lawson
+ *
+ * This program is free software: you can redistribute it and/or modify
+ * it under the terms of the GNU General Public License as published by
+ * the Free Software Foundation, either version 3 of the License, or
+ * (at your option) any later version.
+ *
+ * This program is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ * GNU General Public License for more details.
+ *
+ * You should have received a copy of the GNU General Public License
+ * along with this program.  If not, see <http://www.gnu.org/licenses/>.
+ */
+/**
+ * Lay out a graph which has grown since it was last drawn, keeping the nodes
+ * which were drawn before where they were and only placing the new ones.
+ *
+ * New nodes start at the centre of their neighbours which are already placed,
+ * and are then moved by a force directed relaxation in which only the new
+ * nodes move. The work done depends on the number of new nodes, not the size
+ * of the whole graph.
+ */
+#pragma once
+
+#include <iostream>
+#include <string>
+#include <utility>
+#include <vector>
+
+#include "ogdf/basic/GraphAttributes.h"
+
+namespace qvlayout {
+/**
+ * Positions of the nodes of a graph laid out before, along with a key to match
+ * each node by: the text of its quiver, or empty if that is not known.
+ */
+struct PreviousLayout {
+  std::vector<std::pair<double, double>> coords;
+  std::vector<std::string> keys;
+};
+/**
+ * Read the positions from a .qvb file, keyed by the quiver of each node, or a
+ * GML file, keyed by the node labels.
+ * @throws std::runtime_error if the file cannot be read or has no positions
+ */
+PreviousLayout read_previous(const std::string& path);
+/** Keys of the nodes of the graph taken from their labels. */
+std::vector<std::string> label_keys(const ogdf::Graph& graph,
+                                    const ogdf::GraphAttributes& attr);
+/**
+ * Move the nodes of the graph to their previous positions. Nodes are matched
+ * by key if the previous layout and keys both have one for every node, where
+ * nodes with the same key are matched in order, and otherwise by their order
+ * in the graph.
+ * @return whether each node, in order, was given a position
+ */
+std::vector<bool> place_known(const PreviousLayout& previous,
+                              const std::vector<std::string>& keys,
+                              const ogdf::Graph& graph,
+                              ogdf::GraphAttributes& attr);
+struct ExtendStats {
+  size_t known;
+  size_t placed;
+  double seconds;
+};
+std::ostream& operator<<(std::ostream& os, const ExtendStats& stats);
+/**
+ * Place the nodes of the graph which are not known, leaving the known nodes
+ * where they are. If fixed is false the whole layout is relaxed afterwards,
+ * so the known positions are only the starting point. If no node is known the
+ * graph is laid out from scratch.
+ */
+ExtendStats extend(ogdf::Graph& graph, ogdf::GraphAttributes& attr,
+                   const std::vector<bool>& known, int size = 10,
+                   bool fixed = true);
+}
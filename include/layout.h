@@ -19,10 +19,25 @@
  * Function to layout a graph.
  */
 #pragma once
+#include <iostream>
+
 #include "ogdf/basic/GraphAttributes.h"
 
 namespace qvlayout {
-enum Method { Energy, Hierachy, Layered, Visibility, Dominance, Balloon};
+enum Method { Energy, Hierachy, Layered, Visibility, Dominance, Balloon, Auto};
+/**
+ * Settings chosen by layout_auto, and how long the layout took.
+ */
+struct AutoSettings {
+	int nodes;
+	int edges;
+	/* Name of the FMMM quality level used for the first pass. */
+	const char* quality;
+	/* Number of refinement passes run after the first. */
+	int refinements;
+	double seconds;
+};
+std::ostream& operator<<(std::ostream& os, const AutoSettings& settings);
 /**
  * Use an energy based layout algorithm to try and find optimal positions for
  * the vertices. This will not always result in the best layout, but will
@@ -35,5 +50,32 @@ void layout(
 		ogdf::GraphAttributes & attr,
 		int size = 10,
 		Method = Method::Energy);
+/**
+ * Energy based layout with the quality chosen from the size of the graph, so
+ * that small quivers get the best layout and large exchange graphs are laid
+ * out quickly. Method::Auto in layout calls this with no budget.
+ *
+ * If budget is positive then after the first pass the layout is refined, from
+ * the positions it has reached, for as long as another pass is expected to
+ * finish within budget seconds of the start. Each refinement starts from the
+ * result of the last, so stopping early leaves the best layout found so far.
+ * The first pass is always run to the end, with the same quality whatever the
+ * budget.
+ */
+AutoSettings layout_auto(
+		ogdf::Graph & graph,
+		ogdf::GraphAttributes & attr,
+		int size = 10,
+		double budget = 0);
+/**
+ * Improve a layout which has already been started. The positions of the nodes
+ * in the GraphAttributes are kept as the initial placement, and fewer
+ * iterations are run than in a full layout, so a good starting point converges
+ * quickly and ends up looking similar.
+ */
+void relax(
+		ogdf::Graph & graph,
+		ogdf::GraphAttributes & attr,
+		int size = 10);
 }
 
@@ -0,0 +1,140 @@
+/*
+ * layout_cache.h
+ * Copyright 2014-2015 John Lawson
+ *
+ * This program is free software: you can redistribute it and/or modify
+ * it under the terms of the GNU General Public License as published by
+ * the Free Software Foundation, either version 3 of the License, or
+ * (at your option) any later version.
+ *
+ * This program is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ * GNU General Public License for more details.
+ *
+ * You should have received a copy of the GNU General Public License
+ * along with this program.  If not, see <http://www.gnu.org/licenses/>.
+ */
+/**
+ * Cache of quiver layouts, shared between runs of the programs.
+ *
+ * Layouts are stored against the permutation invariant hash of the
+ * EquivQuiverMatrix, along with the layout method and node size. Each entry
+ * keeps the matrix that was laid out, so a lookup for any quiver in the same
+ * equivalence class finds it and the coordinates are permuted to match the
+ * vertices of the quiver being drawn.
+ *
+ * Entries are held in memory and, if a directory is given, in one file per key
+ * in that directory. Files are written to a temporary name and then renamed,
+ * so readers never see a partly written file, and a lock file in the directory
+ * is held while a file is read and written back, so any number of processes
+ * can add entries to the same directory at once without losing any.
+ * When the files take up more than the size limit the least recently used are
+ * removed.
+ */
+#pragma once
+
+#include <atomic>
+#include <iostream>
+#include <mutex>
+#include <string>
+#include <unordered_map>
+#include <utility>
+#include <vector>
+
+#include "qv/equiv_quiver_matrix.h"
+
+#include "layout.h"
+
+namespace qvlayout {
+class LayoutCache {
+ public:
+  typedef std::vector<std::pair<double, double>> Coords;
+  struct Stats {
+    size_t hits;
+    size_t misses;
+    size_t writes;
+    size_t evictions;
+  };
+  /** Quivers with more vertices than this are never cached. */
+  static const int MAX_NODES = 32;
+  /** Default limit on the size of the cache directory, in bytes. */
+  static const size_t DEFAULT_MAX_BYTES = 64 * 1024 * 1024;
+  /** Create a cache which is only kept in memory. */
+  LayoutCache();
+  /**
+   * Create a cache which is kept in memory and in the given directory. The
+   * directory is created if it does not exist.
+   */
+  LayoutCache(const std::string& directory,
+              size_t max_bytes = DEFAULT_MAX_BYTES);
+  /**
+   * Look up the layout of the quiver. If found the coordinates are stored in
+   * coords, such that coords[i] is the position of vertex i of the matrix.
+   */
+  bool find(const cluster::IntMatrix& matrix, Method method, int size,
+            Coords& coords);
+  /** Store the coordinates of the vertices of the quiver. */
+  void insert(const cluster::IntMatrix& matrix, Method method, int size,
+              const Coords& coords);
+  Stats stats() const;
+  /** Write the counters as a single line to the stream. */
+  void report(std::ostream& os) const;
+
+ private:
+  struct Entry {
+    cluster::EquivQuiverMatrix matrix;
+    Coords coords;
+  };
+  typedef std::vector<Entry> Bucket;
+  /* Entry as read from a cache file, before it is converted. */
+  struct Record {
+    cluster::IntMatrix matrix;
+    Coords coords;
+  };
+
+  const std::string directory_;
+  const size_t max_bytes_;
+  std::unordered_map<std::string, Bucket> memory_;
+  /* Guards memory_, disk_bytes_ and the updates of the counters, and every
+   * construction and comparison of EquivQuiverMatrix as libqv shares its
+   * equivalence checkers between matrices of the same size. */
+  std::mutex mutex_;
+  std::atomic<size_t> hits_;
+  std::atomic<size_t> misses_;
+  std::atomic<size_t> writes_;
+  std::atomic<size_t> evictions_;
+  /* Total size of the cache files, as far as this cache knows. */
+  size_t disk_bytes_;
+
+  std::string key(const cluster::EquivQuiverMatrix& matrix, Method method,
+                  int size) const;
+  std::string path(const std::string& key) const;
+  const Entry* find_in(const Bucket& bucket,
+                       const cluster::EquivQuiverMatrix& matrix,
+                       Coords& coords);
+  std::vector<Record> load(const std::string& key) const;
+  bool save(const std::string& key, const std::vector<Record>& records);
+  void evict();
+};
+/**
+ * Lay out the graph of the quiver given by the matrix, as constructed by
+ * graph_factory::graph, so that node i is vertex i of the matrix. If a cache
+ * is given then a previous layout of an equivalent quiver is reused, and new
+ * layouts are added to the cache.
+ *
+ * If initial coordinates are given, with one for each node, then the layout
+ * starts from those positions and is only relaxed rather than laid out from
+ * scratch. Such layouts are neither looked up in nor added to the cache, and
+ * initial[i] must be the position of vertex i of this quiver, so this only
+ * makes sense between quivers whose vertices keep their labels.
+ *
+ * Otherwise quivers whose underlying graph is a Dynkin or affine diagram are
+ * given their fixed drawing from dynkin_layout for the force directed
+ * methods, without using the cache.
+ */
+void layout(const cluster::IntMatrix& matrix, ogdf::Graph& graph,
+            ogdf::GraphAttributes& attr, int size, Method method,
+            LayoutCache* cache,
+            const LayoutCache::Coords* initial = nullptr);
+}
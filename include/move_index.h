@@ -0,0 +1,66 @@
+/*
+ * move_index.h
+ * Copyright 2014-2015 John Lawson
+ *
+ * This program is free software: you can redistribute it and/or modify
+ * it under the terms of the GNU General Public License as published by
+ * the Free Software Foundation, either version 3 of the License, or
+ * (at your option) any later version.
+ *
+ * This program is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ * GNU General Public License for more details.
+ *
+ * You should have received a copy of the GNU General Public License
+ * along with this program.  If not, see <http://www.gnu.org/licenses/>.
+ */
+/**
+ * Index of the MMI moves by cheap invariants of their quivers, so that the
+ * moves which cannot apply to a quiver are skipped without searching through
+ * its submatrices.
+ */
+#pragma once
+
+#include <map>
+#include <vector>
+
+#include "qv/int_matrix.h"
+
+#include "consts.h"
+
+namespace qvdraw {
+class MoveIndex {
+ public:
+  explicit MoveIndex(const std::vector<consts::MovePatterns>& patterns);
+  /**
+   * Positions in the list of moves of those which might apply to the quiver.
+   * The result is remembered for all quivers with the same invariants, for as
+   * long as the index. Not safe to call from more than one thread at once.
+   *
+   * The moves considered and skipped are counted in trace::MoveChecks and
+   * trace::MovesPruned.
+   */
+  const std::vector<size_t>& candidates(const cluster::IntMatrix& quiver) const;
+
+ private:
+  /*
+   * A move only applies if one of its quivers is a full subquiver, so that
+   * quiver has no more vertices, each of its arrows appears with the same
+   * weight in the larger quiver, and its vertex with the i-th most neighbours
+   * has no more than the one in the larger quiver.
+   */
+  struct Signature {
+    explicit Signature(const cluster::IntMatrix& matrix);
+    bool fits_in(const Signature& larger) const;
+    bool operator<(const Signature& other) const;
+    int size;
+    /* |b_ij b_ji| for each arrow, in increasing order. */
+    std::vector<int> weights;
+    /* Number of neighbours of each vertex, in decreasing order. */
+    std::vector<int> degrees;
+  };
+  std::vector<std::pair<Signature, Signature>> moves_;
+  mutable std::map<Signature, std::vector<size_t>> memo_;
+};
+}
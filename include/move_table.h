@@ -0,0 +1,91 @@
+/*
+ * move_table.h
+ * Copyright 2014-2015 John Lawson
+ *
+ * This program is free software: you can redistribute it and/or modify
+ * it under the terms of the GNU General Public License as published by
+ * the Free Software Foundation, either version 3 of the License, or
+ * (at your option) any later version.
+ *
+ * This program is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ * GNU General Public License for more details.
+ *
+ * You should have received a copy of the GNU General Public License
+ * along with this program.  If not, see <http://www.gnu.org/licenses/>.
+ */
+/**
+ * Plain data description of the MMI moves, which does not depend on libqv.
+ *
+ * The moves are written out by hand in data/moves.txt. qvmovegen reads that
+ * file and writes src/move_table.cc, which holds the same moves as constant
+ * arrays so that nothing is parsed when a program starts. The same text format
+ * is used for extra moves loaded at run time.
+ */
+#pragma once
+
+#include <cstddef>
+#include <istream>
+#include <string>
+#include <vector>
+
+namespace qvdraw {
+namespace consts {
+/** Requirement on how a vertex of a move connects to the rest of a quiver. */
+enum class Req : int { Unconnected, Line, ConnectedTo, LineTo };
+/** Matrix with its entries row by row, or no matrix if rows is 0. */
+struct MatrixRecord {
+  int rows;
+  int cols;
+  const int* entries;
+};
+struct MoveRecord {
+  MatrixRecord a;
+  MatrixRecord b;
+  /** Vertices which can be connected, with their requirements. The argument
+   * is the other vertex for ConnectedTo and LineTo, and unused otherwise. */
+  size_t num_conn;
+  const int* conn;
+  const Req* reqs;
+  const int* req_args;
+  /** Quivers which must be mutation-finite for the move to apply. */
+  MatrixRecord atob;
+  MatrixRecord btoa;
+};
+/** The moves compiled from data/moves.txt. */
+extern const MoveRecord MOVE_TABLE[];
+extern const size_t MOVE_TABLE_SIZE;
+
+/** Move read from the text format, owning the arrays its record points to. */
+class MoveDefinition {
+ public:
+  struct Matrix {
+    int rows = 0;
+    int cols = 0;
+    std::vector<int> entries;
+  };
+  Matrix a;
+  Matrix b;
+  std::vector<int> conn;
+  std::vector<Req> reqs;
+  std::vector<int> req_args;
+  Matrix atob;
+  Matrix btoa;
+  /** Line of the file on which the move starts. */
+  size_t line = 0;
+  /** View of the definition, valid until it is next changed. */
+  MoveRecord record() const;
+};
+/**
+ * Read the moves in the text format of data/moves.txt.
+ * @throws std::runtime_error giving the line of the first mistake
+ */
+std::vector<MoveDefinition> read_moves(std::istream& is);
+/**
+ * Parse a matrix in the usual format, "{ { 0 1 } { -1 0 } }".
+ * @throws std::invalid_argument if it is not a matrix
+ */
+MoveDefinition::Matrix parse_matrix(const std::string& str);
+}
+}
@@ -0,0 +1,308 @@
+/*
+ * parallel_explore.h
+ * Copyright 2014-2015 John Lawson
+ *
+ * This program is free software: you can redistribute it and/or modify
+ * it under the terms of the GNU General Public License as published by
+ * the Free Software Foundation, either version 3 of the License, or
+ * (at your option) any later version.
+ *
+ * This program is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ * GNU General Public License for more details.
+ *
+ * You should have received a copy of the GNU General Public License
+ * along with this program.  If not, see <http://www.gnu.org/licenses/>.
+ */
+/**
+ * Breadth first exploration of quiver graphs on a number of threads.
+ *
+ * The graph is explored one level at a time. The vertices of each level are
+ * split between the threads, and a thread which runs out of vertices steals
+ * half of those left to another thread. New vertices are looked up in a
+ * visited table split into stripes, each with its own lock, so threads only
+ * wait for each other when they find vertices in the same stripe.
+ *
+ * At the end of each level the new vertices are numbered in the order of the
+ * vertex they were first found from, so the graph is the same whatever the
+ * number of threads.
+ */
+#pragma once
+
+#include <algorithm>
+#include <cstdint>
+#include <deque>
+#include <exception>
+#include <mutex>
+#include <thread>
+#include <type_traits>
+#include <unordered_map>
+#include <utility>
+#include <vector>
+
+#include "qv/quiver_matrix.h"
+
+#include "explore.h"
+#include "graph_factory.h"
+#include "trace.h"
+
+namespace qvdraw {
+namespace explore {
+/**
+ * Whether the vertices can be hashed, compared and stepped from on more than
+ * one thread at once. libqv shares its equivalence checkers between all
+ * EquivQuiverMatrix objects of the same size, and GiNaC expressions cannot be
+ * copied on more than one thread, so only labelled quivers and g-vector seeds
+ * can. Other graphs are explored in the same way on a single thread.
+ */
+template <class M>
+struct concurrent : std::false_type {};
+template <>
+struct concurrent<cluster::QuiverMatrix> : std::true_type {};
+template <>
+struct concurrent<GVectorSeed> : std::true_type {};
+namespace detail {
+const size_t PENDING = SIZE_MAX;
+const size_t DROPPED = SIZE_MAX - 1;
+/* Number of vertices a thread takes from its range at a time. */
+const size_t CHUNK = 16;
+const size_t STRIPES = 64;
+template <class M>
+struct Entry {
+  explicit Entry(M&& n) : node(std::move(n)) {}
+  M node;
+  size_t id = PENDING;
+  /* First place the vertex was found from, as the number of the vertex and
+   * the position of the link from it. */
+  std::pair<size_t, size_t> found;
+};
+template <class M>
+struct Stripe {
+  std::mutex mutex;
+  NodeKeyMap<const M*, Entry<M>*> map;
+  std::deque<Entry<M>> entries;
+  /* Entries found in this level which do not have a number yet. */
+  std::vector<Entry<M>*> pending;
+};
+/* Part of the current level still to be explored by one thread. */
+struct Range {
+  std::mutex mutex;
+  size_t begin = 0;
+  size_t end = 0;
+};
+inline bool take(Range& range, size_t& begin, size_t& end) {
+  std::lock_guard<std::mutex> lock(range.mutex);
+  if (range.begin >= range.end) {
+    return false;
+  }
+  begin = range.begin;
+  end = std::min(begin + CHUNK, range.end);
+  range.begin = end;
+  return true;
+}
+/* Move half of the work left in another range into the thread's own. */
+inline bool steal(std::vector<Range>& ranges, size_t self) {
+  for (size_t i = 1; i < ranges.size(); ++i) {
+    Range& victim = ranges[(self + i) % ranges.size()];
+    size_t begin;
+    size_t end;
+    {
+      std::lock_guard<std::mutex> lock(victim.mutex);
+      if (victim.begin >= victim.end) {
+        continue;
+      }
+      size_t half = (victim.end - victim.begin + 1) / 2;
+      end = victim.end;
+      begin = end - half;
+      victim.end = begin;
+    }
+    std::lock_guard<std::mutex> lock(ranges[self].mutex);
+    ranges[self].begin = begin;
+    ranges[self].end = end;
+    return true;
+  }
+  return false;
+}
+}
+template <class M>
+class ExploredGraph;
+template <class M, class Step>
+ExploredGraph<M> parallel_explore(const M& initial, const Step& step,
+                                  size_t threads, size_t limit = SIZE_MAX);
+/**
+ * Graph found by parallel_explore. Iterating over it gives pairs of each
+ * vertex along with its links, in the same way as the libqv graphs, so it can
+ * be passed to graph_factory::multi_graph. Links to vertices which were not
+ * explored because of the limit are null.
+ */
+template <class M>
+class ExploredGraph {
+ public:
+  typedef std::vector<const M*> Links;
+  typedef std::vector<std::pair<const M*, Links>> Nodes;
+  typedef typename Nodes::const_iterator const_iterator;
+  const_iterator begin() const { return nodes_.begin(); }
+  const_iterator end() const { return nodes_.end(); }
+  size_t size() const { return nodes_.size(); }
+
+ private:
+  std::vector<std::deque<detail::Entry<M>>> storage_;
+  Nodes nodes_;
+
+  template <class N, class Step>
+  friend ExploredGraph<N> parallel_explore(const N& initial, const Step& step,
+                                           size_t threads, size_t limit);
+};
+/**
+ * Explore the graph from the initial vertex using the given number of
+ * threads, taking the neighbours of each vertex from the step as in explore.
+ * No more than limit vertices are explored.
+ */
+template <class M, class Step>
+ExploredGraph<M> parallel_explore(const M& initial, const Step& step,
+                                  size_t threads, size_t limit) {
+  trace::Scope scope("parallel explore");
+  typedef detail::Entry<M> Entry;
+  ExploredGraph<M> result;
+  if (limit == 0) {
+    return result;
+  }
+  if (!concurrent<M>::value || threads < 1) {
+    threads = 1;
+  }
+  std::vector<detail::Stripe<M>> stripes(detail::STRIPES);
+  auto stripe_of = [&](const NodeKey<const M*>& key) -> detail::Stripe<M>& {
+    return stripes[key.hash % stripes.size()];
+  };
+
+  M first(initial);
+  NodeKey<const M*> first_key(&first);
+  detail::Stripe<M>& start = stripe_of(first_key);
+  start.entries.emplace_back(std::move(first));
+  Entry* root = &start.entries.back();
+  root->id = 0;
+  first_key.node = &root->node;
+  start.map.emplace(std::move(first_key), root);
+  result.nodes_.emplace_back(&root->node, typename ExploredGraph<M>::Links());
+
+  std::vector<Entry*> level{root};
+  std::vector<std::vector<Entry*>> links;
+  while (!level.empty()) {
+    const bool full = result.nodes_.size() >= limit;
+    links.assign(level.size(), std::vector<Entry*>());
+    /* Follow every link from the vertex, adding new vertices to the stripes
+     * as pending until the level is finished. */
+    auto visit = [&](size_t i) {
+      const Entry* parent = level[i];
+      std::vector<Entry*>& out = links[i];
+      step(parent->node, [&](M&& neighbour) {
+        const std::pair<size_t, size_t> found(parent->id, out.size());
+        NodeKey<const M*> key(&neighbour);
+        detail::Stripe<M>& stripe = stripe_of(key);
+        std::lock_guard<std::mutex> lock(stripe.mutex);
+        auto existing = stripe.map.find(key);
+        if (existing != stripe.map.end()) {
+          Entry* entry = existing->second;
+          if (entry->id == detail::PENDING && found < entry->found) {
+            entry->found = found;
+          }
+          out.push_back(entry);
+        } else if (full) {
+          out.push_back(nullptr);
+        } else {
+          stripe.entries.emplace_back(std::move(neighbour));
+          Entry* entry = &stripe.entries.back();
+          entry->found = found;
+          key.node = &entry->node;
+          stripe.map.emplace(std::move(key), entry);
+          stripe.pending.push_back(entry);
+          out.push_back(entry);
+        }
+      });
+    };
+    /* Small levels are not worth starting threads for. */
+    const size_t used =
+        std::min(threads, (level.size() + detail::CHUNK - 1) / detail::CHUNK);
+    if (used <= 1) {
+      for (size_t i = 0; i < level.size(); ++i) {
+        visit(i);
+      }
+    } else {
+      std::vector<detail::Range> ranges(used);
+      for (size_t t = 0; t < used; ++t) {
+        ranges[t].begin = level.size() * t / used;
+        ranges[t].end = level.size() * (t + 1) / used;
+      }
+      std::exception_ptr error;
+      std::mutex error_mutex;
+      auto work = [&](size_t self) {
+        try {
+          size_t begin;
+          size_t end;
+          while (detail::take(ranges[self], begin, end) ||
+                 (detail::steal(ranges, self) &&
+                  detail::take(ranges[self], begin, end))) {
+            for (size_t i = begin; i < end; ++i) {
+              visit(i);
+            }
+          }
+        } catch (...) {
+          std::lock_guard<std::mutex> lock(error_mutex);
+          if (!error) {
+            error = std::current_exception();
+          }
+        }
+      };
+      std::vector<std::thread> pool;
+      for (size_t t = 1; t < used; ++t) {
+        pool.emplace_back(work, t);
+      }
+      work(0);
+      for (std::thread& thread : pool) {
+        thread.join();
+      }
+      if (error) {
+        std::rethrow_exception(error);
+      }
+    }
+    /* Number the new vertices by where they were first found. */
+    std::vector<Entry*> next;
+    for (detail::Stripe<M>& stripe : stripes) {
+      next.insert(next.end(), stripe.pending.begin(), stripe.pending.end());
+      stripe.pending.clear();
+    }
+    std::sort(next.begin(), next.end(), [](const Entry* a, const Entry* b) {
+      return a->found < b->found;
+    });
+    size_t kept = 0;
+    for (Entry* entry : next) {
+      if (result.nodes_.size() < limit) {
+        entry->id = result.nodes_.size();
+        result.nodes_.emplace_back(&entry->node,
+                                   typename ExploredGraph<M>::Links());
+        next[kept++] = entry;
+      } else {
+        entry->id = detail::DROPPED;
+      }
+    }
+    next.resize(kept);
+    for (size_t i = 0; i < level.size(); ++i) {
+      typename ExploredGraph<M>::Links& out =
+          result.nodes_[level[i]->id].second;
+      out.reserve(links[i].size());
+      for (const Entry* entry : links[i]) {
+        bool explored = entry != nullptr && entry->id != detail::DROPPED;
+        out.push_back(explored ? &entry->node : nullptr);
+      }
+    }
+    level = std::move(next);
+  }
+  result.storage_.reserve(stripes.size());
+  for (detail::Stripe<M>& stripe : stripes) {
+    result.storage_.push_back(std::move(stripe.entries));
+  }
+  return result;
+}
+}
+}
@@ -0,0 +1,157 @@
+/*
+ * qvb.h
+ * Copyright 2014-2015 John Lawson
+ *
+ * This program is free software: you can redistribute it and/or modify
+ * it under the terms of the GNU General Public License as published by
+ * the Free Software Foundation, either version 3 of the License, or
+ * (at your option) any later version.
+ *
+ * This program is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ * GNU General Public License for more details.
+ *
+ * You should have received a copy of the GNU General Public License
+ * along with this program.  If not, see <http://www.gnu.org/licenses/>.
+ */
+/**
+ * Binary graph format used to pass large graphs between the programs.
+ *
+ * A .qvb file starts with a Header, followed by these sections, each padded to
+ * a multiple of 8 bytes:
+ *
+ *   uint64_t matrix offsets[nodes + 1]   into the matrix data, in ints
+ *   int32_t  matrix data[]               rows, columns then the entries
+ *   uint64_t node label offsets[nodes + 1]
+ *   char     node labels[]
+ *   uint64_t edge offsets[nodes + 1]     out-edges of each node, as CSR
+ *   uint64_t edge targets[edges]
+ *   uint64_t edge label offsets[edges + 1]
+ *   char     edge labels[]
+ *   double   coordinates[2 * nodes]      x, y of each node, if HAS_COORDS
+ *
+ * Nodes without a quiver have an empty matrix record. All values are in the
+ * byte order of the machine which wrote the file.
+ *
+ * The file is read through mmap, so nothing is parsed or copied when it is
+ * loaded and pages are only read from disk as they are used.
+ */
+#pragma once
+
+#include <cstdint>
+#include <iostream>
+#include <string>
+#include <vector>
+
+#include "qv/int_matrix.h"
+
+namespace qvdraw {
+namespace qvb {
+const uint32_t VERSION = 1;
+/** Set in Header::flags if the file holds the position of each node. */
+const uint32_t HAS_COORDS = 1;
+struct Header {
+  /** Always "QVB" followed by a zero byte. */
+  char magic[4];
+  uint32_t version;
+  uint32_t flags;
+  uint32_t reserved;
+  uint64_t nodes;
+  uint64_t edges;
+  /** Number of ints in the matrix data. */
+  uint64_t matrix_ints;
+  /** Number of bytes of node and edge labels. */
+  uint64_t node_chars;
+  uint64_t edge_chars;
+};
+/**
+ * Collects the nodes and edges of a graph and writes them as a .qvb file.
+ * Edges can be added in any order.
+ */
+class Builder {
+ public:
+  /** Add a node with no quiver, returning its number. */
+  size_t add_node(const std::string& label = std::string());
+  /** Add a node representing the quiver, returning its number. */
+  size_t add_node(const cluster::IntMatrix& matrix,
+                  const std::string& label = std::string());
+  void add_edge(size_t source, size_t target,
+                const std::string& label = std::string());
+  /**
+   * Set the position of a node. Positions are only written if at least one
+   * is set, and any others are then at the origin.
+   */
+  void set_position(size_t node, double x, double y);
+  size_t size() const { return node_labels_.size(); }
+  void write(std::ostream& os) const;
+  /** @throws std::runtime_error if the file cannot be written */
+  void write(const std::string& path) const;
+
+ private:
+  struct Edge {
+    size_t source;
+    size_t target;
+    std::string label;
+  };
+  std::vector<uint64_t> matrix_offsets_{0};
+  std::vector<int32_t> matrix_data_;
+  std::vector<std::string> node_labels_;
+  std::vector<Edge> edges_;
+  std::vector<double> coords_;
+};
+/**
+ * Graph of a single quiver, with a node for each vertex and an edge for each
+ * arrow labelled as in gml::edge_label.
+ */
+Builder quiver(const cluster::IntMatrix& matrix);
+/**
+ * Graph mapped read-only from a .qvb file. The accessors read straight from
+ * the mapping, which stays valid as long as this object.
+ */
+class MappedGraph {
+ public:
+  /** @throws std::runtime_error if the file cannot be read or is not valid */
+  explicit MappedGraph(const std::string& path);
+  ~MappedGraph();
+  MappedGraph(const MappedGraph&) = delete;
+  MappedGraph& operator=(const MappedGraph&) = delete;
+  size_t size() const { return header_->nodes; }
+  size_t num_edges() const { return header_->edges; }
+  /** Out-edges of node v are the edges numbered offset(v) to offset(v + 1). */
+  size_t offset(size_t v) const { return edge_offsets_[v]; }
+  size_t target(size_t e) const { return targets_[e]; }
+  /** Source of the edge, found by binary search of the offsets. */
+  size_t source(size_t e) const;
+  bool has_matrix(size_t v) const {
+    return matrix_offsets_[v + 1] > matrix_offsets_[v];
+  }
+  cluster::IntMatrix matrix(size_t v) const;
+  std::string node_label(size_t v) const {
+    return std::string(node_chars_ + node_label_offsets_[v],
+                       node_label_offsets_[v + 1] - node_label_offsets_[v]);
+  }
+  std::string edge_label(size_t e) const {
+    return std::string(edge_chars_ + edge_label_offsets_[e],
+                       edge_label_offsets_[e + 1] - edge_label_offsets_[e]);
+  }
+  bool has_coordinates() const { return coords_ != nullptr; }
+  double x(size_t v) const { return coords_[2 * v]; }
+  double y(size_t v) const { return coords_[2 * v + 1]; }
+
+ private:
+  void* data_;
+  size_t length_;
+  const Header* header_;
+  const uint64_t* matrix_offsets_;
+  const int32_t* matrix_data_;
+  const uint64_t* node_label_offsets_;
+  const char* node_chars_;
+  const uint64_t* edge_offsets_;
+  const uint64_t* targets_;
+  const uint64_t* edge_label_offsets_;
+  const char* edge_chars_;
+  const double* coords_;
+};
+}
+}
@@ -0,0 +1,69 @@
+/**
+ * raster.h
+ * Copyright 2014-2015 John Lawson
+ *
+ * This program is free software: you can redistribute it and/or modify
+ * it under the terms of the GNU General Public License as published by
+ * the Free Software Foundation, either version 3 of the License, or
+ * (at your option) any later version.
+ *
+ * This program is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ * GNU General Public License for more details.
+ *
+ * You should have received a copy of the GNU General Public License
+ * along with this program.  If not, see <http://www.gnu.org/licenses/>.
+ */
+/**
+ * Small anti-aliased rasteriser with a PNG encoder.
+ *
+ * This only supports the handful of shapes needed to draw a quiver: lines,
+ * discs, triangles for arrow heads and short labels made of digits and signs.
+ * No external image libraries are needed.
+ */
+#pragma once
+
+#include <cstdint>
+#include <iostream>
+#include <string>
+#include <vector>
+
+namespace qvdraw {
+namespace raster {
+struct Colour {
+  uint8_t r;
+  uint8_t g;
+  uint8_t b;
+};
+class Canvas {
+ public:
+  Canvas(int width, int height, Colour background = {255, 255, 255});
+  int width() const { return width_; }
+  int height() const { return height_; }
+  /** Draw a line segment of the given thickness with round ends. */
+  void line(double x0, double y0, double x1, double y1, double thickness,
+            Colour colour);
+  /** Draw a filled disc. */
+  void disc(double x, double y, double radius, Colour colour);
+  /** Draw a filled triangle. */
+  void triangle(double x0, double y0, double x1, double y1, double x2,
+                double y2, Colour colour);
+  /**
+   * Draw a label centred on the point. Only digits, ',', '-', '+' and '.' can
+   * be drawn, other characters are left as blank spaces.
+   */
+  void text(double x, double y, const std::string& str, int scale,
+            Colour colour);
+  /** Encode the canvas as a PNG image. */
+  void write_png(std::ostream& os) const;
+
+ private:
+  int width_;
+  int height_;
+  std::vector<uint8_t> pixels_;
+
+  void blend(int x, int y, double alpha, Colour colour);
+};
+}
+}
@@ -0,0 +1,60 @@
+/**
+ * render.h
+ * Copyright 2014-2015 John Lawson
+ *
+ * This program is free software: you can redistribute it and/or modify
+ * it under the terms of the GNU General Public License as published by
+ * the Free Software Foundation, either version 3 of the License, or
+ * (at your option) any later version.
+ *
+ * This program is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ * GNU General Public License for more details.
+ *
+ * You should have received a copy of the GNU General Public License
+ * along with this program.  If not, see <http://www.gnu.org/licenses/>.
+ */
+/**
+ * Render laid out graphs as pictures.
+ *
+ * The node positions are taken straight from the GraphAttributes, and any
+ * edge labels set by graph_factory::graph are drawn at the middle of the
+ * edge. This works for both single quivers and the multi-graphs, so the
+ * external gml2pic program is no longer needed.
+ */
+#pragma once
+
+#include <iostream>
+#include <string>
+
+#include "ogdf/basic/Graph_d.h"
+#include "ogdf/basic/GraphAttributes.h"
+
+namespace qvdraw {
+namespace render {
+enum class Format { GML, SVG, PNG };
+struct Style {
+  /** Width in pixels of the longer side of a PNG picture. */
+  int width = 400;
+  /** Whether to draw arrow heads on the edges. */
+  bool arrows = true;
+};
+/**
+ * Get the format from its name, one of gml, svg or png.
+ * @throws std::invalid_argument if the name is not recognised
+ */
+Format format(const std::string& name);
+/** File extension, including the '.', used for the format. */
+std::string extension(Format format);
+/** Write the graph as an SVG picture. */
+void svg(std::ostream& os, const ogdf::Graph& graph,
+         const ogdf::GraphAttributes& attr, const Style& style = Style());
+/** Write the graph as a PNG picture. */
+void png(std::ostream& os, const ogdf::Graph& graph,
+         const ogdf::GraphAttributes& attr, const Style& style = Style());
+/** Write the graph in the given format. */
+void write(Format format, std::ostream& os, const ogdf::Graph& graph,
+           const ogdf::GraphAttributes& attr, const Style& style = Style());
+}
+}
@@ -0,0 +1,191 @@
+/*
+ * tex.h
+ * Copyright 2014-2015 John Lawson
+ *
+ * This program is free software: you can redistribute it and/or modify
+ * it under the terms of the GNU General Public License as published by
+ * the Free Software Foundation, either version 3 of the License, or
+ * (at your option) any later version.
+ *
+ * This program is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ * GNU General Public License for more details.
+ *
+ * You should have received a copy of the GNU General Public License
+ * along with this program.  If not, see <http://www.gnu.org/licenses/>.
+ */
+/**
+ * Output of the TikZ code for graphs with a very large number of vertices.
+ *
+ * Text is collected in a single reusable buffer which is written to the stream
+ * in large blocks, and numbers are formatted directly into the buffer with a
+ * fixed number of decimal places rather than through the stream operators.
+ */
+#pragma once
+
+#include <iostream>
+#include <string>
+#include <utility>
+#include <vector>
+
+#include "ogdf/basic/Graph_d.h"
+#include "ogdf/basic/GraphAttributes.h"
+
+#include "trace.h"
+
+namespace qv2tex {
+class TexBuffer {
+ public:
+  /** Number of decimal places written for coordinates. */
+  static const int PRECISION = 2;
+  /** Default size of the buffer before it is written to the stream. */
+  static const size_t DEFAULT_CAPACITY = 1 << 20;
+  /**
+   * Buffer which is written to the stream whenever it grows past the capacity,
+   * and when it is destroyed.
+   */
+  explicit TexBuffer(std::ostream& os, size_t capacity = DEFAULT_CAPACITY);
+  /** Buffer which is never written out, and is read back with str(). */
+  TexBuffer();
+  ~TexBuffer();
+  TexBuffer(const TexBuffer&) = delete;
+  TexBuffer& operator=(const TexBuffer&) = delete;
+
+  TexBuffer& operator<<(const char* str);
+  TexBuffer& operator<<(const std::string& str);
+  TexBuffer& operator<<(const ogdf::String& str);
+  TexBuffer& operator<<(char c);
+  TexBuffer& operator<<(int value);
+  TexBuffer& operator<<(size_t value);
+  /** Write the number with exactly PRECISION decimal places. */
+  TexBuffer& operator<<(double value);
+  /**
+   * Write the number in the letters used in TeX macro names, as given by
+   * int_to_str.
+   */
+  TexBuffer& letters(int value);
+  /** Write out the contents of the buffer, if there is a stream. */
+  void flush();
+  const std::string& str() const { return buffer_; }
+
+ private:
+  std::ostream* os_;
+  size_t capacity_;
+  std::string buffer_;
+
+  void check() {
+    if (os_ != nullptr && buffer_.size() >= capacity_) {
+      flush();
+    }
+  }
+};
+/**
+ * Convert the integer into a string of letters, so that it can be used in the
+ * name of a TeX macro.
+ */
+std::string int_to_str(int a);
+/**
+ * TikZ picture of a quiver which only depends on what is drawn, and not on the
+ * order of the vertices and arrows in the graph. Vertices are sorted by their
+ * position and label, and the arrows by the vertices they join.
+ *
+ * Two quivers with the same glyph look the same, so only one box needs to be
+ * saved for all of them.
+ */
+std::string glyph(const ogdf::Graph& graph,
+                  const ogdf::GraphAttributes& attr,
+                  const char* color = "black");
+/** Maximum number of edges joined into a single \draw path. */
+const size_t EDGES_PER_PATH = 256;
+/**
+ * Write the picture of the whole graph, with each vertex drawn as the box
+ * previously saved under the name "node" + int_to_str(index).
+ *
+ * The table is indexed by the index of each node, and holds the quiver or seed
+ * at that node. Nodes which are not in the table, or which have a null entry,
+ * are not drawn, nor are any edges which meet them.
+ *
+ * If glyphs are given then they are indexed in the same way, and each vertex
+ * is instead drawn as the box "glyph" + int_to_str(glyphs[index]). The edges
+ * are then collected by colour and drawn as a few long paths.
+ */
+template <class M, class Colour, class Label>
+void draw_graph(TexBuffer& out,
+                const ogdf::Graph& graph,
+                const ogdf::GraphAttributes& attr,
+                const std::vector<const M*>& table,
+                const Colour& colouring,
+                Label& labelling,
+                const std::vector<int>* glyphs = nullptr) {
+  qvdraw::trace::Scope scope("write tex");
+  auto lookup = [&table](ogdf::node node) -> const M* {
+    size_t index = node->index();
+    return index < table.size() ? table[index] : nullptr;
+  };
+  out << "\\scalebox{\\picscale}{%\n";
+  out << "\\begin{tikzpicture}[x=\\grsize,y=\\grsize,scale=\\grscale]\n";
+  ogdf::node node;
+  forall_nodes(node, graph) {
+    const M* mat = lookup(node);
+    if (mat == nullptr) {
+      continue;
+    }
+    out << "\\node[inner sep=0pt,outer sep=0pt] (n" << node->index()
+        << ") at (" << attr.x(node) << ',' << attr.y(node) << "){\\usebox{";
+    if (glyphs == nullptr) {
+      out << "\\node";
+      out.letters(node->index()) << "}};\n";
+    } else {
+      out << "\\glyph";
+      out.letters((*glyphs)[node->index()]) << "}};\n";
+    }
+    if (labelling.has_label(mat)) {
+      out << "\\node[draw,very thin,anchor=north east,"
+          << colouring.vertex_colour(mat) << "] at (n" << node->index()
+          << ".north west) {" << labelling.label(mat) << "};\n";
+    }
+  }
+  /* Edges of each colour, in the order the colours are first seen. */
+  std::vector<std::pair<std::string, std::vector<ogdf::edge>>> paths;
+  ogdf::edge e;
+  forall_edges(e, graph) {
+    const M* source = lookup(e->source());
+    const M* target = lookup(e->target());
+    if (source == nullptr || target == nullptr) {
+      continue;
+    }
+    if (glyphs == nullptr) {
+      out << "\\draw[line width=.05pt,"
+          << colouring.edge_colour(source, target) << "](n"
+          << e->source()->index() << ") -- (n" << e->target()->index()
+          << ");\n";
+      continue;
+    }
+    std::string colour = colouring.edge_colour(source, target);
+    auto path = paths.begin();
+    while (path != paths.end() && path->first != colour) {
+      ++path;
+    }
+    if (path == paths.end()) {
+      paths.emplace_back(colour, std::vector<ogdf::edge>());
+      path = paths.end() - 1;
+    }
+    path->second.push_back(e);
+  }
+  for (const auto& path : paths) {
+    const std::vector<ogdf::edge>& edges = path.second;
+    for (size_t i = 0; i < edges.size(); ++i) {
+      if (i % EDGES_PER_PATH == 0) {
+        out << "\\draw[line width=.05pt," << path.first << ']';
+      }
+      out << "(n" << edges[i]->source()->index() << ")--(n"
+          << edges[i]->target()->index() << ')';
+      if (i % EDGES_PER_PATH == EDGES_PER_PATH - 1 || i + 1 == edges.size()) {
+        out << ";\n";
+      }
+    }
+  }
+  out << "\\end{tikzpicture}}%\n";
+}
+}
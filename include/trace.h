@@ -0,0 +1,112 @@
+/*
+ * trace.h
+ * Copyright 2014-2015 John Lawson
+ *
+ * This program is free software: you can redistribute it and/or modify
+ * it under the terms of the GNU General Public License as published by
+ * the Free Software Foundation, either version 3 of the License, or
+ * (at your option) any later version.
+ *
+ * This program is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ * GNU General Public License for more details.
+ *
+ * You should have received a copy of the GNU General Public License
+ * along with this program.  If not, see <http://www.gnu.org/licenses/>.
+ */
+/**
+ * Timeline and counters of a run, shared by all of the programs.
+ *
+ * Every program accepts --trace=FILE, which writes the time spent in each
+ * stage as Chrome trace event JSON (open it in chrome://tracing or Perfetto),
+ * and --stats, which prints the counters and peak memory use to stderr at the
+ * end of the run. Both are removed from the arguments by init before the
+ * program reads its own options.
+ *
+ * When neither is given each Scope and count is a test of a flag which never
+ * changes, so they can be left in the hot paths.
+ */
+#pragma once
+
+#include <atomic>
+#include <chrono>
+#include <cstddef>
+#include <iostream>
+
+namespace qvdraw {
+namespace trace {
+enum Counter {
+  Nodes,
+  Edges,
+  /* Equality checks between vertices with the same hash which were not
+   * equal. */
+  HashCollisions,
+  EqualityCalls,
+  Layouts,
+  /* Iterations of the passes which improve an existing layout, in relax,
+   * the refinements of layout_auto and the placement of new vertices by
+   * extend. A full FMMM layout chooses its own iterations inside OGDF, which
+   * are not counted. */
+  RefineIterations,
+  BytesWritten,
+  /* Seeds whose cluster variables had the same fingerprints, and those of
+   * them which were not equal. */
+  FingerprintMatches,
+  FingerprintFalsePositives,
+  /* MMI moves considered for a quiver, and those of them skipped by the move
+   * index without being tried. */
+  MoveChecks,
+  MovesPruned,
+  NUM_COUNTERS
+};
+namespace detail {
+typedef std::chrono::steady_clock Clock;
+/* Only set by init, before any threads are started. */
+extern bool counting;
+extern bool tracing;
+extern std::atomic<size_t> counters[NUM_COUNTERS];
+void record(const char* name, Clock::time_point start);
+}
+/**
+ * Remove --trace=FILE and --stats from the arguments, updating argc, and turn
+ * on whichever was given. The trace and counters are written when the program
+ * exits. Must be called at the start of main.
+ */
+void init(int& argc, char* argv[]);
+/** Whether the counters are being kept. */
+inline bool enabled() { return detail::counting; }
+inline void count(Counter counter, size_t amount = 1) {
+  if (detail::counting) {
+    detail::counters[counter].fetch_add(amount, std::memory_order_relaxed);
+  }
+}
+/** Write the counters and the peak memory use on one line. */
+void report(std::ostream& os);
+/**
+ * Adds the time from its construction to its destruction to the trace as a
+ * stage with the given name, which must outlive the program, such as a string
+ * literal.
+ */
+class Scope {
+ public:
+  explicit Scope(const char* name)
+      : name_(detail::tracing ? name : nullptr) {
+    if (name_ != nullptr) {
+      start_ = detail::Clock::now();
+    }
+  }
+  ~Scope() {
+    if (name_ != nullptr) {
+      detail::record(name_, start_);
+    }
+  }
+  Scope(const Scope&) = delete;
+  Scope& operator=(const Scope&) = delete;
+
+ private:
+  const char* const name_;
+  detail::Clock::time_point start_;
+};
+}
+}
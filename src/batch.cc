@@ -0,0 +1,183 @@
+/**
+ * batch.cc
+ * Copyright 2014-2015 John Lawson
+ *
+ * This program is free software: you can redistribute it and/or modify
+ * it under the terms of the GNU General Public License as published by
+ * the Free Software Foundation, either version 3 of the License, or
+ * (at your option) any later version.
+ *
+ * This program is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ * GNU General Public License for more details.
+ *
+ * You should have received a copy of the GNU General Public License
+ * along with this program.  If not, see <http://www.gnu.org/licenses/>.
+ */
+#include "batch.h"
+
+#include <fstream>
+#include <condition_variable>
+#include <map>
+#include <mutex>
+#include <sstream>
+#include <stdexcept>
+#include <thread>
+#include <vector>
+
+#include "qv/quiver_matrix.h"
+
+#include "graph_factory.h"
+#include "trace.h"
+#include "work_queue.h"
+
+namespace qvdraw {
+namespace batch {
+namespace {
+struct Job {
+  size_t number;
+  std::string matrix;
+};
+struct Result {
+  size_t number;
+  std::string drawing;
+  std::string error;
+};
+bool blank(const std::string& line) {
+  return line.find_first_not_of(" \t\r") == std::string::npos;
+}
+Result process(const Job& job, const Options& opts) {
+  Result result{job.number, std::string(), std::string()};
+  try {
+    std::ostringstream os;
+    draw(job.matrix, opts, os);
+    result.drawing = os.str();
+  } catch (const std::exception& e) {
+    result.error = "Could not draw " + job.matrix + ": " + e.what();
+  }
+  return result;
+}
+bool write(const Result& result, const Options& opts) {
+  if (!result.error.empty()) {
+    std::cerr << result.error << std::cerr.widen('\n');
+    return false;
+  }
+  std::string name = filename(opts, result.number);
+  std::ofstream os(name, std::ios::binary);
+  if (!os) {
+    std::cerr << "Could not open " << name << " for writing"
+              << std::cerr.widen('\n');
+    return false;
+  }
+  os << result.drawing;
+  trace::count(trace::BytesWritten, result.drawing.size());
+  return true;
+}
+/* Read the input stream, handing each matrix to the callback with its number.
+ * Returns false from the callback to stop reading early. */
+template <class F>
+void read(std::istream& is, const Options& opts, F&& f) {
+  size_t number = opts.first;
+  std::string line;
+  while (std::getline(is, line)) {
+    if (blank(line)) {
+      continue;
+    }
+    if (!f(Job{number++, std::move(line)})) {
+      break;
+    }
+  }
+}
+void count(bool written, Summary& summary) {
+  ++(written ? summary.written : summary.failed);
+}
+Summary run_sequential(std::istream& is, const Options& opts) {
+  Summary summary;
+  read(is, opts, [&opts, &summary](Job job) {
+    count(write(process(job, opts), opts), summary);
+    return true;
+  });
+  return summary;
+}
+/*
+ * The reader, the layout workers and the writer are connected by bounded
+ * queues, so only a few drawings are ever held in memory at once. Results can
+ * arrive at the writer out of order, so are held back until all drawings with
+ * smaller numbers have been written. A worker does not start a drawing more
+ * than capacity numbers ahead of the next one to be written, so a slow quiver
+ * cannot make the drawings held back grow without limit. The jobs are taken
+ * in order, so the drawing being waited for is always already being drawn.
+ *
+ * OGDF must be built with a thread safe memory pool for this to be used.
+ */
+Summary run_parallel(std::istream& is, const Options& opts) {
+  const size_t capacity = 4 * opts.jobs;
+  WorkQueue<Job> jobs(capacity);
+  WorkQueue<Result> results(capacity);
+  Summary summary;
+  /* Number of the next drawing to write, shared with the workers. */
+  std::mutex mutex;
+  std::condition_variable written;
+  size_t next = opts.first;
+
+  std::thread writer([&] {
+    std::map<size_t, Result> pending;
+    Result result;
+    while (results.pop(result)) {
+      pending.emplace(result.number, std::move(result));
+      for (auto it = pending.find(next); it != pending.end();
+           it = pending.find(next)) {
+        count(write(it->second, opts), summary);
+        pending.erase(it);
+        {
+          std::lock_guard<std::mutex> lock(mutex);
+          ++next;
+        }
+        written.notify_all();
+      }
+    }
+  });
+  std::vector<std::thread> workers;
+  workers.reserve(opts.jobs);
+  for (size_t i = 0; i < opts.jobs; ++i) {
+    workers.emplace_back([&] {
+      Job job;
+      while (jobs.pop(job)) {
+        {
+          std::unique_lock<std::mutex> lock(mutex);
+          written.wait(lock, [&] { return job.number < next + capacity; });
+        }
+        results.push(process(job, opts));
+      }
+    });
+  }
+  read(is, opts, [&jobs](Job job) { return jobs.push(std::move(job)); });
+  jobs.close();
+  for (std::thread& worker : workers) {
+    worker.join();
+  }
+  results.close();
+  writer.join();
+  return summary;
+}
+}
+std::string filename(const Options& opts, size_t number) {
+  return opts.directory + "/" + std::to_string(number) +
+         render::extension(opts.format);
+}
+void draw(const std::string& matrix, const Options& opts, std::ostream& os) {
+  cluster::QuiverMatrix mat(matrix);
+  auto pair = graph_factory::graph(mat);
+  qvlayout::layout(mat, *pair.first, *pair.second, opts.size, opts.method,
+                   opts.cache);
+  render::write(opts.format, os, *pair.first, *pair.second, opts.style);
+}
+Summary run(std::istream& is, const Options& opts) {
+  if (opts.jobs > 1) {
+    return run_parallel(is, opts);
+  }
+  return run_sequential(is, opts);
+}
+}
+}
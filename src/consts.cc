@@ -16,433 +16,112 @@
  * along with this program.  If not, see <http://www.gnu.org/licenses/>.
  */
 /**
- * Contains all the class representatives and all moves.
+ * Contains all the moves.
  *
- * This just initialises the data structures used by the program to check
- * moves. There are some helper functions to create the moves, matrices and
- * graphs.
+ * The moves themselves are defined in data/moves.txt and compiled into the
+ * constant table in move_table.cc, so starting a program does not parse any
+ * matrices. The MMIMove objects are only built from the table the first time
+ * they are used.
  */
 #include "consts.h"
 
+#include <fstream>
+#include <stdexcept>
+
 #include "qv/mass_finite_check.h"
 
+#include "move_table.h"
+
 namespace qvdraw {
 namespace consts {
 
 namespace {
-	cluster::MMIMove make_move(const std::string& a,
-			const std::string& b, std::initializer_list<int> c,
-			std::initializer_list<cluster::MMIMove::ConnReq> r) {
-		return cluster::MMIMove(
-				cluster::IntMatrix(a), cluster::IntMatrix(b),
-				std::vector<int>(c), std::vector<cluster::MMIMove::ConnReq>(r));
-	}
-	template<typename F>
-	cluster::MMIMove make_move(const std::string& a,
-			const std::string& b, std::initializer_list<int> c,
-			std::initializer_list<cluster::MMIMove::ConnReq> r,
-			cluster::mmi_conn::Finite<F> atob) {
-		auto res = cluster::MMIMove(
-				cluster::IntMatrix(a), cluster::IntMatrix(b),
-				std::vector<int>(c), std::vector<cluster::MMIMove::ConnReq>(r));
-		res.finite_req_atob(atob);
-		return res;
-	}
-	template<typename F1, typename F2>
-	cluster::MMIMove make_move(const std::string& a,
-			const std::string& b, std::initializer_list<int> c,
-			std::initializer_list<cluster::MMIMove::ConnReq> r,
-			cluster::mmi_conn::Finite<F1> atob,
-			cluster::mmi_conn::Finite<F2> btoa) {
-		auto res = cluster::MMIMove(
-				cluster::IntMatrix(a), cluster::IntMatrix(b),
-				std::vector<int>(c), std::vector<cluster::MMIMove::ConnReq>(r));
-		res.finite_req_atob(atob);
-		res.finite_req_btoa(btoa);
-		return res;
-	}
 	struct MassFinite {
 		bool operator()(const cluster::EquivQuiverMatrix & mat) {
+			/* Only set up once a move with a finite requirement is checked. */
+			static cluster::MassFiniteCheck chk;
 			return chk.is_finite(mat);
 		}
-		private:
-		static cluster::MassFiniteCheck chk;
 	};
-	cluster::MassFiniteCheck MassFinite::chk;
 	typedef cluster::mmi_conn::Finite<MassFinite> FinReq;
+	cluster::IntMatrix matrix(const MatrixRecord& rec) {
+		return cluster::IntMatrix(rec.rows, rec.cols, rec.entries);
+	}
+	cluster::MMIMove::ConnReq conn_req(Req req, int other) {
+		using namespace cluster::mmi_conn;
+		switch(req) {
+			case Req::Unconnected:
+				return Unconnected();
+			case Req::Line:
+				return Line();
+			case Req::ConnectedTo:
+				return ConnectedTo(other);
+			case Req::LineTo:
+				return LineTo(other);
+		}
+		throw std::invalid_argument("Unknown connection requirement");
+	}
+	cluster::MMIMove make_move(const MoveRecord& rec) {
+		std::vector<int> conn(rec.conn, rec.conn + rec.num_conn);
+		std::vector<cluster::MMIMove::ConnReq> reqs;
+		reqs.reserve(rec.num_conn);
+		for(size_t i = 0; i < rec.num_conn; ++i) {
+			reqs.push_back(conn_req(rec.reqs[i], rec.req_args[i]));
+		}
+		cluster::MMIMove res(matrix(rec.a), matrix(rec.b), conn, reqs);
+		if(rec.atob.rows > 0) {
+			res.finite_req_atob(FinReq(cluster::EquivQuiverMatrix(matrix(rec.atob))));
+		}
+		if(rec.btoa.rows > 0) {
+			res.finite_req_btoa(FinReq(cluster::EquivQuiverMatrix(matrix(rec.btoa))));
+		}
+		return res;
+	}
+}
+const std::vector<cluster::MMIMove>& moves() {
+	static const std::vector<cluster::MMIMove> result = [] {
+		std::vector<cluster::MMIMove> built;
+		built.reserve(MOVE_TABLE_SIZE);
+		for(size_t i = 0; i < MOVE_TABLE_SIZE; ++i) {
+			built.push_back(make_move(MOVE_TABLE[i]));
+		}
+		return built;
+	}();
+	return result;
+}
+const std::vector<MovePatterns>& patterns() {
+	static const std::vector<MovePatterns> result = [] {
+		std::vector<MovePatterns> built;
+		built.reserve(MOVE_TABLE_SIZE);
+		for(size_t i = 0; i < MOVE_TABLE_SIZE; ++i) {
+			built.push_back({matrix(MOVE_TABLE[i].a), matrix(MOVE_TABLE[i].b)});
+		}
+		return built;
+	}();
+	return result;
+}
+std::vector<cluster::MMIMove> load_moves(const std::string& path,
+		std::vector<MovePatterns>* patterns) {
+	std::ifstream file(path);
+	if(!file) {
+		throw std::runtime_error("Could not open " + path);
+	}
+	std::vector<MoveDefinition> defs;
+	try {
+		defs = read_moves(file);
+	} catch(const std::runtime_error& e) {
+		throw std::runtime_error(path + ": " + e.what());
+	}
+	std::vector<cluster::MMIMove> result;
+	result.reserve(defs.size());
+	for(const MoveDefinition& def : defs) {
+		MoveRecord rec = def.record();
+		result.push_back(make_move(rec));
+		if(patterns != nullptr) {
+			patterns->push_back({matrix(rec.a), matrix(rec.b)});
+		}
+	}
+	return result;
 }
-using namespace cluster::mmi_conn;
-std::vector<cluster::MMIMove> Moves = {
-	/* Moves for 6 x 6 */
-	make_move("{ { 0 1 0 } { -1 0 1 } { 0 -1 0 } }",
-			"{ { 0 -1 1 } { 1 0 -1 } { -1 1 0 } }", {0, 2}, {Unconnected(), Line()}),
-	make_move("{ { 0 -1 0 } { 1 0 -1 } { 0 1 0 } }",/*Transpose*/
-			"{ { 0 1 -1 } { -1 0 1 } { 1 -1 0 } }", {0, 2}, {Unconnected(), Line()}),
-	make_move("{ { 0 1 0 0 } { -1 0 1 1 } { 0 -1 0 0 } { 0 -1 0 0 } }",
-			"{ { 0 -1 1 1 } { 1 0 -1 -1 } { -1 1 0 0 } { -1 1 0 0 } }",
-			{ 0, 2, 3 }, { Line(), ConnectedTo(3), ConnectedTo(2) }),
-	make_move("{ { 0 -1 0 0 } { 1 0 -1 -1 } { 0 1 0 0 } { 0 1 0 0 } }", /*Transpose */
-			"{ { 0 1 -1 -1 } { -1 0 1 1 } { 1 -1 0 0 } { 1 -1 0 0 } }",
-			{ 0, 2, 3 }, { Line(), ConnectedTo(3), ConnectedTo(2) }),
-	make_move("{ { 0 0 -1 0 0 } { 0 0 -1 0 0 } { 1 1 0 1 -1 } { 0 0 -1 0 2 } "
-			"{ 0 0 1 -2 0 } }", "{ { 0 -1 0 0 1 } { 1 0 -1 1 -1 } { 0 1 0 0 1 } "
-			"{ 0 -1 0 0 1 } { -1 1 -1 -1 0 } }", {0}, {Unconnected()}),
-	make_move("{ { 0 1 0 0 0 } { -1 0 -1 -1 1 } { 0 1 0 0 0 } { 0 1 0 0 0 } "
-			"{ 0 -1 0 0 0 } }", "{ { 0 -1 0 0 1 } { 1 0 1 1 -1 } { 0 -1 0 0 1 } "
-			"{ 0 -1 0 0 1 } { -1 1 -1 -1 0 } }", {0, 4}, {Unconnected(), Line()}),
-	make_move("{ { 0 -1 0 0 0 } { 1 0 1 1 -1 } { 0 -1 0 0 0 } { 0 -1 0 0 0 } " /*Transpose*/
-			"{ 0 1 0 0 0 } }", "{ { 0 1 0 0 -1 } { -1 0 -1 -1 1 } { 0 1 0 0 -1 } "
-			"{ 0 1 0 0 -1 } { 1 -1 1 1 0 } }", {0, 4}, {Unconnected(), Line()}),
-	/* 6 x 6 'specials' */
-	make_move("{ { 0 -1 -1 -1 -1 1 } { 1 0 0 0 0 0 } { 1 0 0 0 0 0 } "
-			"{ 1 0 0 0 0 0 } { 1 0 0 0 0 0 } { -1 0 0 0 0 0 } }",
-			"{ { 0 1 1 1 1 -1 } { -1 0 0 0 0 1 } { -1 0 0 0 0 1 } { -1 0 0 0 0 1 } "
-			"{ -1 0 0 0 0 1 } { 1 -1 -1 -1 -1 0 } }", {} , {}),
-	make_move("{ { 0 -1 -1 -1 1 -1 } { 1 0 0 0 0 0 } { 1 0 0 0 0 0 } "
-			"{ 1 0 0 0 0 0 } { -1 0 0 0 0 2 } { 1 0 0 0 -2 0 } }",
-			"{ { 0 1 1 1 -1 1 } { -1 0 0 0 1 0 } { -1 0 0 0 1 0 } { -1 0 0 0 1 0 } "
-			"{ 1 -1 -1 -1 0 1 } { -1 0 0 0 -1 0 } }", {}, {}),
-	/* Moves for 7 x 7 */
-	make_move("{ { 0 1 0 -1 } { -1 0 1 1 } { 0 -1 0 -1 } { 1 -1 1 0 } }",
-			"{ { 0 1 0 0 } { -1 0 -1 1 } { 0 1 0 -2 } { 0 -1 2 0 } }",
-			{ 0 }, {Unconnected()}),
-	make_move("{ { 0 -1 0 1 } { 1 0 -1 -1 } { 0 1 0 1 } { -1 1 -1 0 } }", /*Transpose*/
-			"{ { 0 -1 0 0 } { 1 0 1 -1 } { 0 -1 0 2 } { 0 1 -2 0 } }",
-			{ 0 }, {Unconnected()}),
-	make_move("{ { 0 1 0 0 } { -1 0 1 -1 } { 0 -1 0 1 } { 0 1 -1 0 } }",
-			"{ { 0 -1 1 0 } { 1 0 -1 1 } { -1 1 0 0 } { 0 -1 0 0 } }",
-			{0, 2, 3}, { Unconnected(), LineTo(3), LineTo(2) }),
-	make_move("{ { 0 -1 0 0 } { 1 0 -1 1 } { 0 1 0 -1 } { 0 -1 1 0 } }",
-			"{ { 0 1 -1 0 } { -1 0 1 -1 } { 1 -1 0 0 } { 0 1 0 0 } }",
-			{0, 2, 3}, { Unconnected(), LineTo(3), LineTo(2) }),
-	make_move("{ { 0 1 0 0 0 } { -1 0 -1 1 -1 } { 0 1 0 0 0 } { 0 -1 0 0 1 } "
-			"{ 0 1 0 -1 0 } }",
-			"{ { 0 -1 0 1 0 } { 1 0 1 -1 1 } { 0 -1 0 1 0 } { -1 1 -1 0 0 } "
-			"{ 0 -1 0 0 0 } }",
-			{0, 3, 4 }, {Unconnected(), LineTo(4), LineTo(3) }),
-	make_move("{ { 0 -1 0 0 0 } { 1 0 1 -1 1 } { 0 -1 0 0 0 } { 0 1 0 0 -1 } "/*Transpose*/
-			"{ 0 -1 0 1 0 } }",
-			"{ { 0 1 0 -1 0 } { -1 0 -1 1 -1 } { 0 1 0 -1 0 } { 1 -1 1 0 0 } "
-			"{ 0 1 0 0 0 } }",
-			{0, 3, 4 }, {Unconnected(), LineTo(4), LineTo(3) }),
-	/* 7 x 7 'special' */
-	make_move("{ { 0 0 -1 0 0 0 } { 0 0 -1 0 0 0 } { 1 1 0 1 -1 0 } "
-			"{ 0 0 -1 0 1 -1 } { 0 0 1 -1 0 1 } { 0 0 0 1 -1 0 } }",
-			"{ { 0 1 0 0 -1 0 } { -1 0 -1 -1 1 0 } { 0 1 0 0 0 -1 } "
-			"{ 0 1 0 0 -1 0 } { 1 -1 0 1 0 1 } { 0 0 1 0 -1 0 } }",
-			{5},{Line()}),
-	make_move("{ { 0 0 1 0 0 0 } { 0 0 1 0 0 0 } { -1 -1 0 -1 1 0 } " /*Transpose*/
-			"{ 0 0 1 0 -1 1 } { 0 0 -1 1 0 -1 } { 0 0 0 -1 1 0 } }",
-			"{ { 0 -1 0 0 1 0 } { 1 0 1 1 -1 0 } { 0 -1 0 0 0 1 } "
-			"{ 0 -1 0 0 1 0 } { -1 1 0 -1 0 -1 } { 0 0 -1 0 1 0 } }",
-			{5},{Line()}),
-	/* 8 x 8 moves */
-	make_move("{ { 0 1 0 0 0 } { -1 0 -1 0 0 } { 0 1 0 -1 1 } { 0 0 1 0 0 } "
-			"{ 0 0 -1 0 0 } }",
-			"{ { 0 -1 1 0 0 } { 1 0 -1 1 0 } { -1 1 0 0 -1 } { 0 -1 0 0 1 } "
-			"{ 0 0 1 -1 0 } }",
-			{0, 3, 4}, {Unconnected(), Line(), Line() }),
-	make_move("{ { 0 1 0 -1 } { -1 0 -1 1 } { 0 1 0 0 } { 1 -1 0 0 } }",
-			"{ { 0 -1 0 0 } { 1 0 1 -1 } { 0 -1 0 1 } { 0 1 -1 0 } }",
-			{0, 2, 3}, {Unconnected(), Unconnected(), Unconnected() }),
-	make_move("{ { 0 1 0 0 } { -1 0 1 -1 } { 0 -1 0 1 } { 0 1 -1 0 } }",
-			"{ { 0 -1 1 0 } { 1 0 -1 1 } { -1 1 0 0 } { 0 -1 0 0 } }",
-			{0, 2, 3}, {Unconnected(), LineTo(3), LineTo(2) }),
-	make_move("{ { 0 -1 0 0 0 0 } { 1 0 1 0 0 0 } { 0 -1 0 1 -1 0 } "
-			"{ 0 0 -1 0 0 0 } { 0 0 1 0 0 1 } { 0 0 0 0 -1 0 } }",
-			"{ { 0 1 -1 0 0 0 } { -1 0 1 -1 0 0 } { 1 -1 0 1 -1 1 } { 0 1 -1 0 1 0 } "
-			"{ 0 0 1 -1 0 -1 } { 0 0 -1 0 1 0 } }",
-			{0, 3, 5}, {Line(), Line(), Line() }),
-	make_move("{ { 0 1 0 0 0 0 } { -1 0 -1 0 0 0 } { 0 1 0 -1 1 0 } " /*Transpose*/
-			"{ 0 0 1 0 0 0 } { 0 0 -1 0 0 -1 } { 0 0 0 0 1 0 } }",
-			"{ { 0 -1 1 0 0 0 } { 1 0 -1 1 0 0 } { -1 1 0 -1 1 -1 } { 0 -1 1 0 -1 0 } "
-			"{ 0 0 -1 1 0 1 } { 0 0 1 0 -1 0 } }",
-			{0, 3, 5}, {Line(), Line(), Line() }),
-	make_move("{ { 0 0 0 -1 1 } { 0 0 0 0 -1 } { 0 0 0 -1 1 } { 1 0 1 0 -1 } "
-			"{ -1 1 -1 1 0 } }",
-			"{ { 0 1 0 0 -1 } { -1 0 -1 0 1 } { 0 1 0 0 -1 } { 0 0 0 0 1 } "
-			"{ 1 -1 1 -1 0 } }",
-			{ 0, 1, 2, 3}, {Unconnected(),Unconnected(),Unconnected(),Unconnected()}),
-	/* 8 x 8 special */
-	make_move("{ { 0 1 0 0 0 0 0 0 } { -1 0 -1 1 0 0 0 0 } { 0 1 0 0 0 0 0 0 } "
-			"{ 0 -1 0 0 -1 0 0 0 } { 0 0 0 1 0 1 -1 0 } { 0 0 0 0 -1 0 0 0 } "
-			"{ 0 0 0 0 1 0 0 1 } { 0 0 0 0 0 0 -1 0 } }",
-			"{ { 0 -1 0 0 1 0 0 0 } { 1 0 1 1 -1 0 0 0 } { 0 -1 0 0 1 0 0 0 } "
-			"{ 0 -1 0 0 0 0 1 0 } { -1 1 -1 0 0 -1 0 0 } { 0 0 0 0 1 0 -1 0 } "
-			"{ 0 0 0 -1 0 1 0 1 } { 0 0 0 0 0 0 -1 0 } }",
-			{}, {}),
-	make_move("{ { 0 1 0 0 -1 0 0 -1 } { -1 0 -1 0 1 0 -1 0 } { 0 1 0 -1 0 0 0 0 } "
-			"{ 0 0 1 0 -1 0 0 0 } { 1 -1 0 1 0 1 0 0 } { 0 0 0 0 -1 0 1 0 } "
-			"{ 0 1 0 0 0 -1 0 0 } { 1 0 0 0 0 0 0 0 } }",
-			"{ { 0 0 0 0 1 0 0 -1 } { 0 0 -1 1 -1 1 -1 0 } { 0 1 0 -1 0 0 0 0 } "
-			"{ 0 -1 1 0 1 0 0 0 } { -1 1 0 -1 0 -1 0 0 } { 0 -1 0 0 1 0 1 0 } "
-			"{ 0 1 0 0 0 -1 0 0 } { 1 0 0 0 0 0 0 0 } }",
-			{}, {}),
-	/* 9 x 9 moves */
-	make_move("{ { 0 1 0 0 0 -1 } { -1 0 -1 0 0 1 } { 0 1 0 -1 0 0 } "
-			"{ 0 0 1 0 -1 0 } { 0 0 0 1 0 -1 } { 1 -1 0 0 1 0 } }",
-			"{ { 0 0 0 0 0 1 } { 0 0 -1 0 1 -1 } { 0 1 0 -1 0 0 } { 0 0 1 0 -1 0 } "
-			"{ 0 -1 0 1 0 1 } { -1 1 0 0 -1 0 } }",
-			{0, 3, 4}, {Unconnected(), Line(), Unconnected()}),
-	make_move("{ { 0 -1 1 -1 0 } { 1 0 -1 0 0 } { -1 1 0 1 -1 } { 1 0 -1 0 1 } "
-			"{ 0 0 1 -1 0 } }",
-			"{ { 0 -1 0 0 0 } { 1 0 -1 1 0 } { 0 1 0 0 0 } { 0 -1 0 0 1 } "
-			"{ 0 0 0 -1 0 } }",
-			{0, 4}, {Line(), Line()}),
-	make_move("{ { 0 1 -1 1 0 } { -1 0 1 0 0 } { 1 -1 0 -1 1 } { -1 0 1 0 -1 } "/*Transpose*/
-			"{ 0 0 -1 1 0 } }",
-			"{ { 0 1 0 0 0 } { -1 0 1 -1 0 } { 0 -1 0 0 0 } { 0 1 0 0 -1 } "
-			"{ 0 0 0 1 0 } }",
-			{0, 4}, {Line(), Line()}),
-	make_move("{ { 0 -1 0 1 } { 1 0 -1 0 } { 0 1 0 -1 } { -1 0 1 0 } }",
-			"{ { 0 1 0 0 } { -1 0 1 1 } { 0 -1 0 0 } { 0 -1 0 0 } }",
-			{0, 3}, {Line(), Line()}),
-	make_move("{ { 0 -1 1 0 0 0 } { 1 0 -1 0 0 0 } { -1 1 0 1 0 0 } "
-			"{ 0 0 -1 0 1 1 } { 0 0 0 -1 0 0 } { 0 0 0 -1 0 0 } }",
-			"{ { 0 -1 1 0 0 0 } { 1 0 -1 0 0 0 } { -1 1 0 -1 1 1 } "
-			"{ 0 0 1 0 -1 -1 } { 0 0 -1 1 0 0 } { 0 0 -1 1 0 0 } }",
-			{0, 1, 5}, {ConnectedTo(5), Line(), ConnectedTo(0)}),
-	make_move("{ { 0 1 -1 0 0 0 } { -1 0 1 0 0 0 } { 1 -1 0 -1 0 0 } "/*Transpose*/
-			"{ 0 0 1 0 -1 -1 } { 0 0 0 1 0 0 } { 0 0 0 1 0 0 } }",
-			"{ { 0 1 -1 0 0 0 } { -1 0 1 0 0 0 } { 1 -1 0 1 -1 -1 } "
-			"{ 0 0 -1 0 1 1 } { 0 0 1 -1 0 0 } { 0 0 1 -1 0 0 } }",
-			{0, 1, 5}, {ConnectedTo(5), Line(), ConnectedTo(0)}),
-	make_move("{ { 0 1 -1 0 0 0 } { -1 0 1 -1 0 0 } { 1 -1 0 1 -1 0 } "
-			"{ 0 1 -1 0 1 -1 } { 0 0 1 -1 0 1 } { 0 0 0 1 -1 0 } }",
-			"{ { 0 -1 0 0 0 0 } { 1 0 1 0 0 0 } { 0 -1 0 1 -1 0 } { 0 0 -1 0 0 0 } "
-			"{ 0 0 1 0 0 -1 } { 0 0 0 0 1 0 } }",
-			{0, 5}, {Line(), Line()}),
-	make_move("{ { 0 -1 1 0 0 0 } { 1 0 -1 1 0 0 } { -1 1 0 -1 1 0 } "/*Transpose*/
-			"{ 0 -1 1 0 -1 1 } { 0 0 -1 1 0 -1 } { 0 0 0 -1 1 0 } }",
-			"{ { 0 1 0 0 0 0 } { -1 0 -1 0 0 0 } { 0 1 0 -1 1 0 } { 0 0 1 0 0 0 } "
-			"{ 0 0 -1 0 0 1 } { 0 0 0 0 -1 0 } }",
-			{0, 5}, {Line(), Line()}),
-	make_move("{ { 0 1 -1 0 0 0 } { -1 0 1 1 0 -1 } { 1 -1 0 0 -1 1 } "
-			"{ 0 -1 0 0 0 1 } { 0 0 1 0 0 -1 } { 0 1 -1 -1 1 0 } }",
-			"{ { 0 1 0 0 0 0 } { -1 0 -1 0 0 0 } { 0 1 0 -1 0 0 } { 0 0 1 0 -1 1 } "
-			"{ 0 0 0 1 0 0 } { 0 0 0 -1 0 0 } } ",
-			{0, 5}, {Line(), Line()}),
-	make_move("{ { 0 -1 0 1 0 0 0 } { 1 0 -1 -1 1 0 0 } { 0 1 0 0 0 0 0 } "
-			"{ -1 1 0 0 -1 1 -1 } { 0 -1 0 1 0 -1 0 } { 0 0 0 -1 1 0 1 } "
-			"{ 0 0 0 1 0 -1 0 } }",
-			"{ { 0 1 0 0 0 0 0 } { -1 0 -1 0 0 0 0 } { 0 1 0 -1 -1 0 0 } "
-			"{ 0 0 1 0 0 0 0 } { 0 0 1 0 0 1 0 } { 0 0 0 0 -1 0 1 } "
-			"{ 0 0 0 0 0 -1 0 } }",
-			{0, 6}, {Line(), Line()}),
-	make_move("{ { 0 1 0 -1 0 0 0 } { -1 0 1 1 -1 0 0 } { 0 -1 0 0 0 0 0 } "/* Transpose*/
-			"{ 1 -1 0 0 1 -1 1 } { 0 1 0 -1 0 1 0 } { 0 0 0 1 -1 0 -1 } "
-			"{ 0 0 0 -1 0 1 0 } }",
-			"{ { 0 -1 0 0 0 0 0 } { 1 0 1 0 0 0 0 } { 0 -1 0 1 1 0 0 } "
-			"{ 0 0 -1 0 0 0 0 } { 0 0 -1 0 0 -1 0 } { 0 0 0 0 1 0 -1 } "
-			"{ 0 0 0 0 0 1 0 } }",
-			{0, 6}, {Line(), Line()}),
-	make_move("{ { 0 1 -1 0 0 0 } { -1 0 1 -1 0 0 } { 1 -1 0 0 -1 1 } "
-			"{ 0 1 0 0 0 -1 } { 0 0 1 0 0 -1 } { 0 0 -1 1 1 0 } }",
-			"{ { 0 1 0 0 0 0 } { -1 0 1 0 0 0 } { 0 -1 0 -1 0 0 } { 0 0 1 0 1 -1 } "
-			"{ 0 0 0 -1 0 0 } { 0 0 0 1 0 0 } }",
-			{0, 5}, {Line(), Line()}),
-	make_move("{ { 0 -1 1 0 0 0 } { 1 0 -1 1 0 0 } { -1 1 0 0 1 -1 } "/*Transpose*/
-			"{ 0 -1 0 0 0 1 } { 0 0 -1 0 0 1 } { 0 0 1 -1 -1 0 } }",
-			"{ { 0 -1 0 0 0 0 } { 1 0 -1 0 0 0 } { 0 1 0 1 0 0 } { 0 0 -1 0 -1 1 } "
-			"{ 0 0 0 1 0 0 } { 0 0 0 -1 0 0 } }",
-			{0, 5}, {Line(), Line()}),
-	make_move("{ { 0 1 -1 0 0 0 } { -1 0 1 0 0 -1 } { 1 -1 0 -1 1 0 } "
-			"{ 0 0 1 0 0 0 } { 0 0 -1 0 0 1 } { 0 1 0 0 -1 0 } }",
-			"{ { 0 0 -1 0 0 0 } { 0 0 -1 -1 1 0 } { 1 1 0 0 0 0 } { 0 1 0 0 0 -1 } "
-			"{ 0 -1 0 0 0 0 } { 0 0 0 1 0 0 } }",
-			{0, 5}, {Line(), Line()}),
-	make_move("{ { 0 -1 1 0 0 0 } { 1 0 -1 0 0 1 } { -1 1 0 1 -1 0 } "/*Transpose*/
-			"{ 0 0 -1 0 0 0 } { 0 0 1 0 0 -1 } { 0 -1 0 0 1 0 } }",
-			"{ { 0 0 1 0 0 0 } { 0 0 1 1 -1 0 } { -1 -1 0 0 0 0 } { 0 -1 0 0 0 1 } "
-			"{ 0 1 0 0 0 0 } { 0 0 0 -1 0 0 } }",
-			{0, 5}, {Line(), Line()}),
-	make_move("{ { 0 -1 0 1 0 0 0 } { 1 0 1 -1 0 0 0 } { 0 -1 0 1 0 -1 0 } "
-			"{ -1 1 -1 0 1 0 0 } { 0 0 0 -1 0 1 -1 } { 0 0 1 0 -1 0 1 } "
-			"{ 0 0 0 0 1 -1 0 } }",
-			"{ { 0 1 0 0 0 0 0 } { -1 0 -1 0 0 0 0 } { 0 1 0 -1 -1 0 0 } "
-			"{ 0 0 1 0 0 0 0 } { 0 0 1 0 0 1 0 } { 0 0 0 0 -1 0 1 } "
-			"{ 0 0 0 0 0 -1 0 } }",
-			{0, 6}, {Line(), Line()}),
-	make_move("{ { 0 1 0 -1 0 0 0 } { -1 0 -1 1 0 0 0 } { 0 1 0 -1 0 1 0 } "/*Transpose*/
-			"{ 1 -1 1 0 -1 0 0 } { 0 0 0 1 0 -1 1 } { 0 0 -1 0 1 0 -1 } "
-			"{ 0 0 0 0 -1 1 0 } }",
-			"{ { 0 -1 0 0 0 0 0 } { 1 0 1 0 0 0 0 } { 0 -1 0 1 1 0 0 } "
-			"{ 0 0 -1 0 0 0 0 } { 0 0 -1 0 0 -1 0 } { 0 0 0 0 1 0 -1 } "
-			"{ 0 0 0 0 0 1 0 } }",
-			{0, 6}, {Line(), Line()}),
-	make_move("{ { 0 -1 1 0 0 0 0 0 } { 1 0 -1 1 0 0 0 0 } { -1 1 0 0 -1 0 0 0 } { 0 -1 0 0 1 -1 0 0 } { 0 0 1 -1 0 0 1 0 } { 0 0 0 1 0 0 -1 1 } { 0 0 0 0 -1 1 0 -1 } { 0 0 0 0 0 -1 1 0 } }",
-			"{ { 0 1 0 0 0 0 0 0 } { -1 0 -1 0 0 0 0 0 } { 0 1 0 1 0 0 0 0 } { 0 0 -1 0 1 -1 0 0 } { 0 0 0 -1 0 0 0 0 } { 0 0 0 1 0 0 1 0 } { 0 0 0 0 0 -1 0 -1 } { 0 0 0 0 0 0 1 0 } }",
-			{0, 7}, {Line(), Line()}),
-	make_move("{ { 0 -1 1 0 0 -1 } { 1 0 -1 0 0 0 } { -1 1 0 1 0 0 } { 0 0 -1 0 1 1 } { 0 0 0 -1 0 0 } { 1 0 0 -1 0 0 } }",
-			"{ { 0 -1 1 0 0 -1 } { 1 0 -1 0 0 0 } { -1 1 0 -1 1 1 } { 0 0 1 0 -1 -1 } { 0 0 -1 1 0 0 } { 1 0 -1 1 0 0 } }",
-			{0, 1, 5}, {ConnectedTo(5), Line(), ConnectedTo(0)}),
-	/* 9 x 9 special */
-	make_move("{ { 0 -1 0 0 0 0 0 0 0 } { 1 0 1 0 0 0 -1 0 0 } { 0 -1 0 -1 0 0 1 0 0 } { 0 0 1 0 -1 0 0 1 0 } { 0 0 0 1 0 -1 0 0 0 } { 0 0 0 0 1 0 -1 0 1 } { 0 1 -1 0 0 1 0 0 0 } { 0 0 0 -1 0 0 0 0 0 } { 0 0 0 0 0 -1 0 0 0 } }",
-			"{ { 0 1 0 0 0 0 0 0 0 } { -1 0 1 0 0 0 0 0 0 } { 0 -1 0 -1 0 0 0 0 0 } { 0 0 1 0 1 0 0 0 0 } { 0 0 0 -1 0 -1 1 0 0 } { 0 0 0 0 1 0 0 0 0 } { 0 0 0 0 -1 0 0 1 0 } { 0 0 0 0 0 0 -1 0 -1 } { 0 0 0 0 0 0 0 1 0 } }",
-			{}, {}),
-	/* 31 */
-	make_move("{ { 0 1 0 } { -1 0 1 } { 0 -1 0 } }",
-			"{ { 0 -1 1 } { 1 0 -1 } { -1 1 0 } }",
-			{0, 2},
-			{ConnectedTo(2), ConnectedTo(0)},
-			FinReq(cluster::EquivQuiverMatrix("{ { 0 0 1 } { 0 0 0 } { -1 0 0 } }")),
-			FinReq(cluster::EquivQuiverMatrix("{ { 0 0 0 } { 0 0 0 } { 0 0 0 } }")) ),
-	make_move(/*Transpose*/
-			"{ { 0 -1 0 } { 1 0 -1 } { 0 1 0 } }",
-			"{ { 0 1 -1 } { -1 0 1 } { 1 -1 0 } }",
-			{0, 2},
-			{ConnectedTo(2), ConnectedTo(0)},
-			FinReq(cluster::EquivQuiverMatrix("{ { 0 0 -1 } { 0 0 0 } { 1 0 0 } }")),
-			FinReq(cluster::EquivQuiverMatrix("{ { 0 0 0 } { 0 0 0 } { 0 0 0 } }")) ),
-	/* 29 & 30 */
-	make_move("{ { 0 1 -1 0 0 } { -1 0 1 0 -1 } { 1 -1 0 1 0 } { 0 0 -1 0 1 } { 0 1 0 -1 0 } }",
-			"{ { 0 -1 0 0 0 } { 1 0 -1 0 1 } { 0 1 0 1 -1 } { 0 0 -1 0 1 } { 0 -1 1 -1 0 } }",
-			{2, 4},
-			{Unconnected(), Unconnected()},
-			FinReq(cluster::EquivQuiverMatrix("{ { 0 0 0 0 0 } { 0 0 -1 0 0 } { 0 1 0 1 0 } { 0 0 -1 0 1 } { 0 0 0 -1 0 } }")) ),
-	make_move(/*Transpose*/
-			"{ { 0 -1 1 0 0 } { 1 0 -1 0 1 } { -1 1 0 -1 0 } { 0 0 1 0 -1 } { 0 -1 0 1 0 } }",
-			"{ { 0 1 0 0 0 } { -1 0 1 0 -1 } { 0 -1 0 -1 1 } { 0 0 1 0 -1 } { 0 1 -1 1 0 } }",
-			{2, 4},
-			{Unconnected(), Unconnected()},
-			FinReq(cluster::EquivQuiverMatrix("{ { 0 0 0 0 0 } { 0 0 1 0 0 } { 0 -1 0 -1 0 } { 0 0 1 0 -1 } { 0 0 0 1 0 } }")) ),
-	make_move("{ { 0 -1 0 0 0 0 0 0 } { 1 0 -1 0 0 0 0 1 } { 0 1 0 1 0 0 0 -1 } { 0 0 -1 0 1 0 0 0 } { 0 0 0 -1 0 1 0 0 } { 0 0 0 0 -1 0 1 0 } { 0 0 0 0 0 -1 0 0 } { 0 -1 1 0 0 0 0 0 } }",
-			"{ { 0 1 -1 0 0 0 0 0 } { -1 0 1 0 0 0 0 -1 } { 1 -1 0 1 0 0 0 0 } { 0 0 -1 0 1 0 0 0 } { 0 0 0 -1 0 1 0 0 } { 0 0 0 0 -1 0 1 0 } { 0 0 0 0 0 -1 0 0 } { 0 1 0 0 0 0 0 0 } }",
-			{0, 5, 7},
-			{Line(), LineTo(7), LineTo(5)},
-			FinReq(cluster::EquivQuiverMatrix("{ { 0 0 -1 0 0 0 0 0 } { 0 0 0 0 0 0 0 0 } { 1 0 0 1 0 0 0 0 } { 0 0 -1 0 1 0 0 0 } { 0 0 0 -1 0 1 0 0 } { 0 0 0 0 -1 0 1 0 } { 0 0 0 0 0 -1 0 0 } { 0 0 0 0 0 0 0 0 } }")) ),
-	make_move("{ { 0 1 0 0 0 0 0 0 } { -1 0 1 0 0 0 0 -1 } { 0 -1 0 -1 0 0 0 1 } { 0 0 1 0 -1 0 0 0 } { 0 0 0 1 0 -1 0 0 } { 0 0 0 0 1 0 -1 0 } { 0 0 0 0 0 1 0 0 } { 0 1 -1 0 0 0 0 0 } }",
-			"{ { 0 -1 1 0 0 0 0 0 } { 1 0 -1 0 0 0 0 1 } { -1 1 0 -1 0 0 0 0 } { 0 0 1 0 -1 0 0 0 } { 0 0 0 1 0 -1 0 0 } { 0 0 0 0 1 0 -1 0 } { 0 0 0 0 0 1 0 0 } { 0 -1 0 0 0 0 0 0 } }",
-			{0, 5, 7},
-			{Line(), LineTo(7), LineTo(5)},
-			FinReq(cluster::EquivQuiverMatrix("{ { 0 0 1 0 0 0 0 0 } { 0 0 0 0 0 0 0 0 } { -1 0 0 -1 0 0 0 0 } { 0 0 1 0 -1 0 0 0 } { 0 0 0 1 0 -1 0 0 } { 0 0 0 0 1 0 -1 0 } { 0 0 0 0 0 1 0 0 } { 0 0 0 0 0 0 0 0 } }")) ),
-	make_move("{ { 0 -1 0 0 0 0 0 } { 1 0 -1 0 0 1 0 } { 0 1 0 1 0 -1 0 } { 0 0 -1 0 1 0 0 } { 0 0 0 -1 0 1 0 } { 0 -1 1 0 -1 0 1 } { 0 0 0 0 0 -1 0 } }",
-			"{ { 0 1 -1 0 0 0 0 } { -1 0 1 0 0 -1 0 } { 1 -1 0 1 0 0 0 } { 0 0 -1 0 1 0 0 } { 0 0 0 -1 0 1 0 } { 0 1 0 0 -1 0 1 } { 0 0 0 0 0 -1 0 } }",
-			{ 0 }, {Line()}),
-	make_move("{ { 0 -1 0 0 0 0 0 0 } { 1 0 1 -1 0 0 0 0 } { 0 -1 0 1 0 0 -1 0 } { 0 1 -1 0 1 0 0 0 } { 0 0 0 -1 0 1 0 0 } { 0 0 0 0 -1 0 1 0 } { 0 0 1 0 0 -1 0 1 } { 0 0 0 0 0 0 -1 0 } }",
-			"{ { 0 1 0 -1 0 0 0 0 } { -1 0 -1 1 0 0 0 0 } { 0 1 0 0 0 0 -1 0 } { 1 -1 0 0 1 0 0 0 } { 0 0 0 -1 0 1 0 0 } { 0 0 0 0 -1 0 1 0 } { 0 0 1 0 0 -1 0 1 } { 0 0 0 0 0 0 -1 0 } }",
-			{ 0 }, { Line() } ),
-	make_move("{ { 0 1 0 0 0 0 0 0 } { -1 0 -1 1 0 0 0 0 } { 0 1 0 -1 0 0 1 0 } { 0 -1 1 0 -1 0 0 0 } { 0 0 0 1 0 -1 0 0 } { 0 0 0 0 1 0 -1 0 } { 0 0 -1 0 0 1 0 -1 } { 0 0 0 0 0 0 1 0 } }",
-			"{ { 0 -1 0 1 0 0 0 0 } { 1 0 1 -1 0 0 0 0 } { 0 -1 0 0 0 0 1 0 } { -1 1 0 0 -1 0 0 0 } { 0 0 0 1 0 -1 0 0 } { 0 0 0 0 1 0 -1 0 } { 0 0 -1 0 0 1 0 -1 } { 0 0 0 0 0 0 1 0 } }",
-			{ 0 }, { Line() } ),
-	/* 32 */
-	make_move("{ { 0 1 0 0 0 0 } { -1 0 1 0 0 0 } { 0 -1 0 -1 0 1 } { 0 0 1 0 1 -1 } { 0 0 0 -1 0 0 } { 0 0 -1 1 0 0 } }",
-		"{ { 0 -1 1 0 0 0 } { 1 0 -1 0 0 0 } { -1 1 0 1 0 0 } { 0 0 -1 0 -1 1 } { 0 0 0 1 0 -1 } { 0 0 0 -1 1 0 } }",
-		{0,5,4},{ConnectedTo(5),ConnectedTo(0),Line()},
-		FinReq(cluster::EquivQuiverMatrix("{ { 0 -1 1 0 0 0 } { 1 0 -1 0 0 0 } { -1 1 0 0 0 0 } { 0 0 0 0 0 0 } { 0 0 0 0 0 -1 } { 0 0 0 0 1 0 } }")),
-		FinReq(cluster::EquivQuiverMatrix("{ { 0 0 0 0 0 0 } { 0 0 0 0 0 0 } { 0 0 0 -1 0 1 } { 0 0 1 0 1 -1 } { 0 0 0 -1 0 0 } { 0 0 -1 1 0 0 } }")) ),
-	make_move(/* Transpose */
-		"{ { 0 -1 0 0 0 0 } { 1 0 -1 0 0 0 } { 0 1 0 1 0 -1 } { 0 0 -1 0 -1 1 } { 0 0 0 1 0 0 } { 0 0 1 -1 0 0 } }",
-		"{ { 0 1 -1 0 0 0 } { -1 0 1 0 0 0 } { 1 -1 0 -1 0 0 } { 0 0 1 0 1 -1 } { 0 0 0 -1 0 1 } { 0 0 0 1 -1 0 } }",
-		{0,5,4},{ConnectedTo(5),ConnectedTo(0),Line()},
-		FinReq(cluster::EquivQuiverMatrix("{ { 0 1 -1 0 0 0 } { -1 0 1 0 0 0 } { 1 -1 0 0 0 0 } { 0 0 0 0 0 0 } { 0 0 0 0 0 1 } { 0 0 0 0 -1 0 } }")),
-		FinReq(cluster::EquivQuiverMatrix("{ { 0 0 0 0 0 0 } { 0 0 0 0 0 0 } { 0 0 0 1 0 -1 } { 0 0 -1 0 -1 1 } { 0 0 0 1 0 0 } { 0 0 1 -1 0 0 } }")) ),
-	/* 33 & 34 */
-	make_move("{ { 0 1 0 -1 0 0 } { -1 0 1 1 0 0 } { 0 -1 0 0 0 0 } { 1 -1 0 0 1 -1 } { 0 0 0 -1 0 1 } { 0 0 0 1 -1 0 } }",
-			"{ { 0 -1 1 0 0 0 } { 1 0 -1 -1 0 0 } { -1 1 0 0 0 0 } { 0 1 0 0 1 -1 } { 0 0 0 -1 0 1 } { 0 0 0 1 -1 0 } }",
-			{0,5,2},{ConnectedTo(5),ConnectedTo(0),Line()},
-			FinReq(cluster::EquivQuiverMatrix("{ { 0 0 1 0 0 0 } { 0 0 0 0 0 0 } { -1 0 0 0 0 0 } { 0 0 0 0 -1 0 } { 0 0 0 1 0 -1 } { 0 0 0 0 1 0 } }")) ),
-	make_move(/*Transpose*/
-			"{ { 0 -1 0 1 0 0 } { 1 0 -1 -1 0 0 } { 0 1 0 0 0 0 } { -1 1 0 0 -1 1 } { 0 0 0 1 0 -1 } { 0 0 0 -1 1 0 } }",
-			"{ { 0 1 -1 0 0 0 } { -1 0 1 1 0 0 } { 1 -1 0 0 0 0 } { 0 -1 0 0 -1 1 } { 0 0 0 1 0 -1 } { 0 0 0 -1 1 0 } }",
-			{0,5,2},{ConnectedTo(5),ConnectedTo(0),Line()},
-			FinReq(cluster::EquivQuiverMatrix("{ { 0 0 -1 0 0 0 } { 0 0 0 0 0 0 } { 1 0 0 0 0 0 } { 0 0 0 0 1 0 } { 0 0 0 -1 0 1 } { 0 0 0 0 -1 0 } }")) ),
-	/* 35 */
-	make_move(
-			"{ { 0 -1 0 0 0 } { 1 0 1 0 -1 } { 0 -1 0 -1 1 } { 0 0 1 0 0 } { 0 1 -1 0 0 } }",
-			"{ { 0 1 -1 0 0 } { -1 0 1 0 0 } { 1 -1 0 1 -1 } { 0 0 -1 0 1 } { 0 0 1 -1 0 } }",
-			{0, 4, 3}, {ConnectedTo(4), ConnectedTo(0), Line()},
-			FinReq(cluster::EquivQuiverMatrix("{ { 0 1 0 0 0 } { -1 0 0 0 0 } { 0 0 0 0 0 } { 0 0 0 0 1 } { 0 0 0 -1 0 } }")),
-			FinReq(cluster::EquivQuiverMatrix("{ { 0 0 0 0 0 } { 0 0 0 0 0 } { 0 0 0 1 0 } { 0 0 -1 0 1 } { 0 0 0 -1 0 } }")) ),
-	make_move(/*Transpose*/
-			"{ { 0 1 0 0 0 } { -1 0 -1 0 1 } { 0 1 0 1 -1 } { 0 0 -1 0 0 } { 0 -1 1 0 0 } }",
-			"{ { 0 -1 1 0 0 } { 1 0 -1 0 0 } { -1 1 0 -1 1 } { 0 0 1 0 -1 } { 0 0 -1 1 0 } }",
-			{0, 4, 3}, {ConnectedTo(4), ConnectedTo(0), Line()},
-			FinReq(cluster::EquivQuiverMatrix("{ { 0 -1 0 0 0 } { 1 0 0 0 0 } { 0 0 0 0 0 } { 0 0 0 0 -1 } { 0 0 0 1 0 } }")),
-			FinReq(cluster::EquivQuiverMatrix("{ { 0 0 0 0 0 } { 0 0 0 0 0 } { 0 0 0 -1 0 } { 0 0 1 0 -1 } { 0 0 0 1 0 } }")) ),
-	/* 25 & 26 */
-	make_move(
-			"{ { 0 -1 0 0 0 0 1 0 } { 1 0 1 0 0 0 -1 0 } { 0 -1 0 1 0 0 0 0 } { 0 0 -1 0 -1 0 1 0 } { 0 0 0 1 0 1 -1 -1 } { 0 0 0 0 -1 0 1 0 } { -1 1 0 -1 1 -1 0 0 } { 0 0 0 0 1 0 0 0 } }",
-			"{ { 0 -1 0 0 0 0 0 0 } { 1 0 -1 0 0 0 1 0 } { 0 1 0 1 0 0 -1 0 } { 0 0 -1 0 1 0 0 0 } { 0 0 0 -1 0 0 1 -1 } { 0 0 0 0 0 0 1 -1 } { 0 -1 1 0 -1 -1 0 1 } { 0 0 0 0 1 1 -1 0 } }",
-			{0,7},{Line(), Line()},
-			FinReq(cluster::EquivQuiverMatrix("{ { 0 -1 0 0 0 0 0 0 } { 1 0 -1 0 0 0 0 0 } { 0 1 0 1 0 0 0 0 } { 0 0 -1 0 1 0 0 0 } { 0 0 0 -1 0 0 0 -1 } { 0 0 0 0 0 0 0 0 } { 0 0 0 0 0 0 0 -1 } { 0 0 0 0 1 0 1 0 } }") ),
-			FinReq(cluster::EquivQuiverMatrix("{ { 0 -1 0 0 0 0 0 0 } { 1 0 1 0 0 0 0 0 } { 0 -1 0 1 0 0 0 0 } { 0 0 -1 0 -1 0 0 0 } { 0 0 0 1 0 1 0 -1 } { 0 0 0 0 -1 0 0 0 } { 0 0 0 0 0 0 0 0 } { 0 0 0 0 1 0 0 0 } }") ) ),
-	make_move(/* Transpose */
-			"{ { 0 1 0 0 0 0 -1 0 } { -1 0 -1 0 0 0 1 0 } { 0 1 0 -1 0 0 0 0 } { 0 0 1 0 1 0 -1 0 } { 0 0 0 -1 0 -1 1 1 } { 0 0 0 0 1 0 -1 0 } { 1 -1 0 1 -1 1 0 0 } { 0 0 0 0 -1 0 0 0 } }",
-			"{ { 0 1 0 0 0 0 0 0 } { -1 0 1 0 0 0 -1 0 } { 0 -1 0 -1 0 0 1 0 } { 0 0 1 0 -1 0 0 0 } { 0 0 0 1 0 0 -1 1 } { 0 0 0 0 0 0 -1 1 } { 0 1 -1 0 1 1 0 -1 } { 0 0 0 0 -1 -1 1 0 } }",
-			{0,7},{Line(), Line()},
-			FinReq(cluster::EquivQuiverMatrix("{ { 0 1 0 0 0 0 0 0 } { -1 0 1 0 0 0 0 0 } { 0 -1 0 -1 0 0 0 0 } { 0 0 1 0 -1 0 0 0 } { 0 0 0 1 0 0 0 1 } { 0 0 0 0 0 0 0 0 } { 0 0 0 0 0 0 0 1 } { 0 0 0 0 -1 0 -1 0 } }") ),
-			FinReq(cluster::EquivQuiverMatrix("{ { 0 1 0 0 0 0 0 0 } { -1 0 -1 0 0 0 0 0 } { 0 1 0 -1 0 0 0 0 } { 0 0 1 0 1 0 0 0 } { 0 0 0 -1 0 -1 0 1 } { 0 0 0 0 1 0 0 0 } { 0 0 0 0 0 0 0 0 } { 0 0 0 0 -1 0 0 0 } }") ) ),
-	make_move(
-			"{ { 0 1 0 -1 0 1 } { -1 0 1 1 0 0 } { 0 -1 0 0 0 0 } { 1 -1 0 0 1 -1 } { 0 0 0 -1 0 1 } { -1 0 0 1 -1 0 } }",
-			"{ { 0 -1 1 0 0 1 } { 1 0 -1 -1 0 0 } { -1 1 0 0 0 0 } { 0 1 0 0 1 -1 } { 0 0 0 -1 0 1 } { -1 0 0 1 -1 0 } }",
-			{0,5,2,4},{ConnectedTo(5),ConnectedTo(0),Line(),Line()},
-			FinReq(cluster::EquivQuiverMatrix("{ { 0 0 1 0 0 1 } { 0 0 0 0 0 0 } { -1 0 0 0 0 0 } { 0 0 0 0 1 -1 } { 0 0 0 -1 0 1 } { -1 0 0 1 -1 0 } }")) ),
-	make_move(/*Transpose*/
-			"{ { 0 -1 0 1 0 -1 } { 1 0 -1 -1 0 0 } { 0 1 0 0 0 0 } { -1 1 0 0 -1 1 } { 0 0 0 1 0 -1 } { 1 0 0 -1 1 0 } }",
-			"{ { 0 1 -1 0 0 -1 } { -1 0 1 1 0 0 } { 1 -1 0 0 0 0 } { 0 -1 0 0 -1 1 } { 0 0 0 1 0 -1 } { 1 0 0 -1 1 0 } }",
-			{0,5,2,4},{ConnectedTo(5),ConnectedTo(0),Line(),Line()},
-			FinReq(cluster::EquivQuiverMatrix("{ { 0 0 -1 0 0 -1 } { 0 0 0 0 0 0 } { 1 0 0 0 0 0 } { 0 0 0 0 -1 1 } { 0 0 0 1 0 -1 } { 1 0 0 -1 1 0 } }")) ),
-				/* 10x10 special */
-	make_move(
-			"{ { 0 -1 0 0 0 0 0 0 0 0 } { 1 0 -1 0 0 0 0 0 0 0 } { 0 1 0 -1 0 0 0 0 0 1 } { 0 0 1 0 1 0 0 0 0 -1 } { 0 0 0 -1 0 1 0 0 0 0 } { 0 0 0 0 -1 0 -1 0 1 0 } { 0 0 0 0 0 1 0 1 -1 0 } { 0 0 0 0 0 0 -1 0 1 0 } { 0 0 0 0 0 -1 1 -1 0 1 } { 0 0 -1 1 0 0 0 0 -1 0 } }",
-			"{ { 0 -1 0 0 0 0 0 0 0 0 } { 1 0 -1 0 0 0 0 0 0 1 } { 0 1 0 1 0 0 0 0 0 -1 } { 0 0 -1 0 1 0 0 0 0 0 } { 0 0 0 -1 0 -1 0 0 1 0 } { 0 0 0 0 1 0 -1 1 -1 0 } { 0 0 0 0 0 1 0 0 0 0 } { 0 0 0 0 0 -1 0 0 1 0 } { 0 0 0 0 -1 1 0 -1 0 1 } { 0 -1 1 0 0 0 0 0 -1 0 } }",
-			{},{}),
-	make_move(/*Transpose*/
-			"{ { 0 1 0 0 0 0 0 0 0 0 } { -1 0 1 0 0 0 0 0 0 0 } { 0 -1 0 1 0 0 0 0 0 -1 } { 0 0 -1 0 -1 0 0 0 0 1 } { 0 0 0 1 0 -1 0 0 0 0 } { 0 0 0 0 1 0 1 0 -1 0 } { 0 0 0 0 0 -1 0 -1 1 0 } { 0 0 0 0 0 0 1 0 -1 0 } { 0 0 0 0 0 1 -1 1 0 -1 } { 0 0 1 -1 0 0 0 0 1 0 } }",
-			"{ { 0 1 0 0 0 0 0 0 0 0 } { -1 0 1 0 0 0 0 0 0 -1 } { 0 -1 0 -1 0 0 0 0 0 1 } { 0 0 1 0 -1 0 0 0 0 0 } { 0 0 0 1 0 1 0 0 -1 0 } { 0 0 0 0 -1 0 1 -1 1 0 } { 0 0 0 0 0 -1 0 0 0 0 } { 0 0 0 0 0 1 0 0 -1 0 } { 0 0 0 0 1 -1 0 1 0 -1 } { 0 1 -1 0 0 0 0 0 1 0 } }",
-			{},{}),
-	make_move(
-			"{ { 0 0 0 -1 1 0 } { 0 0 0 1 0 -1 } { 0 0 0 -1 0 0 } { 1 -1 1 0 -1 1 } { -1 0 0 1 0 0 } { 0 1 0 -1 0 0 } }",
-			"{ { 0 -1 0 1 0 0 } { 1 0 1 -1 0 0 } { 0 -1 0 1 -1 0 } { -1 1 -1 0 1 -1 } { 0 0 1 -1 0 1 } { 0 0 0 1 -1 0 } }",
-			{ 0, 4 }, { Line(), Line() },
-			FinReq(cluster::EquivQuiverMatrix("{ { 0 -1 0 0 0 0 } { 1 0 1 0 0 0 } { 0 -1 0 0 -1 0 } { 0 0 0 0 0 0 } { 0 0 1 0 0 1 } { 0 0 0 0 -1 0 } }")) ),
-	make_move(/*Transpose*/
-			"{ { 0 0 0 1 -1 0 } { 0 0 0 -1 0 1 } { 0 0 0 1 0 0 } { -1 1 -1 0 1 -1 } { 1 0 0 -1 0 0 } { 0 -1 0 1 0 0 } }",
-			"{ { 0 1 0 -1 0 0 } { -1 0 -1 1 0 0 } { 0 1 0 -1 1 0 } { 1 -1 1 0 -1 1 } { 0 0 -1 1 0 -1 } { 0 0 0 -1 1 0 } }",
-			{ 0, 4 }, { Line(), Line() },
-			FinReq(cluster::EquivQuiverMatrix("{ { 0 1 0 0 0 0 } { -1 0 -1 0 0 0 } { 0 1 0 0 1 0 } { 0 0 0 0 0 0 } { 0 0 -1 0 0 -1 } { 0 0 0 0 1 0 } }")) ),
-	make_move(
-			"{ { 0 -1 0 1 0 0 } { 1 0 1 -1 0 0 } { 0 -1 0 1 -1 0 } { -1 1 -1 0 1 -1 } { 0 0 1 -1 0 1 } { 0 0 0 1 -1 0 } }",
-			"{ { 0 -1 0 1 0 0 } { 1 0 -1 0 0 0 } { 0 1 0 -1 1 0 } { -1 0 1 0 0 -1 } { 0 0 -1 0 0 1 } { 0 0 0 1 -1 0 } }",
-			{ 0, 4 }, {Line(), Line()},
-			FinReq(cluster::EquivQuiverMatrix("{ { 0 -1 0 1 0 0 } { 1 0 0 0 0 0 } { 0 0 0 0 0 0 } { -1 0 0 0 0 -1 } { 0 0 0 0 0 1 } { 0 0 0 1 -1 0 } }")),
-			FinReq(cluster::EquivQuiverMatrix("{ { 0 -1 0 1 0 0 } { 1 0 0 -1 0 0 } { 0 0 0 0 0 0 } { -1 1 0 0 1 -1 } { 0 0 0 -1 0 1 } { 0 0 0 1 -1 0 } }")) ),
-	make_move(/*Transpose*/
-			"{ { 0 1 0 -1 0 0 } { -1 0 -1 1 0 0 } { 0 1 0 -1 1 0 } { 1 -1 1 0 -1 1 } { 0 0 -1 1 0 -1 } { 0 0 0 -1 1 0 } }",
-			"{ { 0 1 0 -1 0 0 } { -1 0 1 0 0 0 } { 0 -1 0 1 -1 0 } { 1 0 -1 0 0 1 } { 0 0 1 0 0 -1 } { 0 0 0 -1 1 0 } }",
-			{ 0, 4 }, {Line(), Line()},
-			FinReq(cluster::EquivQuiverMatrix("{ { 0 1 0 -1 0 0 } { -1 0 0 0 0 0 } { 0 0 0 0 0 0 } { 1 0 0 0 0 1 } { 0 0 0 0 0 -1 } { 0 0 0 -1 1 0 } }")),
-			FinReq(cluster::EquivQuiverMatrix("{ { 0 1 0 -1 0 0 } { -1 0 0 1 0 0 } { 0 0 0 0 0 0 } { 1 -1 0 0 -1 1 } { 0 0 0 1 0 -1 } { 0 0 0 -1 1 0 } }")) ),
-	make_move(
-			"{ { 0 1 -1 0 0 0 0 } { -1 0 1 -1 0 1 0 } { 1 -1 0 1 0 0 0 } { 0 1 -1 0 1 -1 0 } { 0 0 0 -1 0 1 0 } { 0 -1 0 1 -1 0 -1 } { 0 0 0 0 0 1 0 } }",
-			"{ { 0 -1 0 0 0 1 0 } { 1 0 -1 1 0 -1 0 } { 0 1 0 0 0 0 0 } { 0 -1 0 0 1 0 0 } { 0 0 0 -1 0 1 0 } { -1 1 0 0 -1 0 -1 } { 0 0 0 0 0 1 0 } }",
-			{0},{Line()}),
-	make_move(/*Tranpose*/
-			"{ { 0 -1 1 0 0 0 0 } { 1 0 -1 1 0 -1 0 } { -1 1 0 -1 0 0 0 } { 0 -1 1 0 -1 1 0 } { 0 0 0 1 0 -1 0 } { 0 1 0 -1 1 0 1 } { 0 0 0 0 0 -1 0 } }",
-			"{ { 0 1 0 0 0 -1 0 } { -1 0 1 -1 0 1 0 } { 0 -1 0 0 0 0 0 } { 0 1 0 0 -1 0 0 } { 0 0 0 1 0 -1 0 } { 1 -1 0 0 1 0 1 } { 0 0 0 0 0 -1 0 } }",
-			{0},{Line()}),
-	make_move(
-			"{ { 0 -1 0 0 0 1 0 } { 1 0 -1 1 0 -1 0 } { 0 1 0 0 0 0 0 } { 0 -1 0 0 1 0 0 } { 0 0 0 -1 0 1 0 } { -1 1 0 0 -1 0 -1 } { 0 0 0 0 0 1 0 } }",
-			"{ { 0 0 0 0 0 -1 0 } { 0 0 -1 1 -1 1 -1 } { 0 1 0 0 0 0 0 } { 0 -1 0 0 1 0 0 } { 0 1 0 -1 0 -1 0 } { 1 -1 0 0 1 0 1 } { 0 1 0 0 0 -1 0 } }",
-			{0},{Line()}),
-	make_move(/*Transpose*/
-			"{ { 0 1 0 0 0 -1 0 } { -1 0 1 -1 0 1 0 } { 0 -1 0 0 0 0 0 } { 0 1 0 0 -1 0 0 } { 0 0 0 1 0 -1 0 } { 1 -1 0 0 1 0 1 } { 0 0 0 0 0 -1 0 } }",
-			"{ { 0 0 0 0 0 1 0 } { 0 0 1 -1 1 -1 1 } { 0 -1 0 0 0 0 0 } { 0 1 0 0 -1 0 0 } { 0 -1 0 1 0 1 0 } { -1 1 0 0 -1 0 -1 } { 0 -1 0 0 0 1 0 } }",
-			{0},{Line()}),
-	make_move(
-			"{ { 0 -1 0 1 0 0 0 0 -1 0 } { 1 0 1 -1 0 0 0 0 0 0 } { 0 -1 0 1 -1 0 0 0 0 0 } { -1 1 -1 0 1 -1 0 0 0 0 } { 0 0 1 -1 0 0 1 0 0 0 } { 0 0 0 1 0 0 -1 0 0 0 } { 0 0 0 0 -1 1 0 1 0 0 } { 0 0 0 0 0 0 -1 0 0 1 } { 1 0 0 0 0 0 0 0 0 0 } { 0 0 0 0 0 0 0 -1 0 0 } }",
-			"{ { 0 -1 0 1 0 0 0 0 -1 0 } { 1 0 1 -1 0 0 0 0 0 0 } { 0 -1 0 1 -1 0 0 0 0 0 } { -1 1 -1 0 1 -1 0 0 0 0 } { 0 0 1 -1 0 1 -1 1 0 0 } { 0 0 0 1 -1 0 1 0 0 0 } { 0 0 0 0 1 -1 0 -1 0 0 } { 0 0 0 0 -1 0 1 0 0 1 } { 1 0 0 0 0 0 0 0 0 0 } { 0 0 0 0 0 0 0 -1 0 0 } }",
-			{},{}),
-	make_move(/*Transpose*/
-			"{ { 0 1 0 -1 0 0 0 0 1 0 } { -1 0 -1 1 0 0 0 0 0 0 } { 0 1 0 -1 1 0 0 0 0 0 } { 1 -1 1 0 -1 1 0 0 0 0 } { 0 0 -1 1 0 0 -1 0 0 0 } { 0 0 0 -1 0 0 1 0 0 0 } { 0 0 0 0 1 -1 0 -1 0 0 } { 0 0 0 0 0 0 1 0 0 -1 } { -1 0 0 0 0 0 0 0 0 0 } { 0 0 0 0 0 0 0 1 0 0 } }",
-			"{ { 0 1 0 -1 0 0 0 0 1 0 } { -1 0 -1 1 0 0 0 0 0 0 } { 0 1 0 -1 1 0 0 0 0 0 } { 1 -1 1 0 -1 1 0 0 0 0 } { 0 0 -1 1 0 -1 1 -1 0 0 } { 0 0 0 -1 1 0 -1 0 0 0 } { 0 0 0 0 -1 1 0 1 0 0 } { 0 0 0 0 1 0 -1 0 0 -1 } { -1 0 0 0 0 0 0 0 0 0 } { 0 0 0 0 0 0 0 1 0 0 } }",
-			{},{}),
-	make_move(
-			"{ { 0 -1 0 1 0 0 0 0 -1 0 } { 1 0 1 -1 0 0 0 0 0 0 } { 0 -1 0 1 -1 0 0 0 0 0 } { -1 1 -1 0 1 -1 0 0 0 0 } { 0 0 1 -1 0 1 -1 1 0 0 } { 0 0 0 1 -1 0 1 0 0 0 } { 0 0 0 0 1 -1 0 -1 0 0 } { 0 0 0 0 -1 0 1 0 0 1 } { 1 0 0 0 0 0 0 0 0 0 } { 0 0 0 0 0 0 0 -1 0 0 } }",
-			"{ { 0 -1 0 1 0 0 0 0 -1 0 } { 1 0 1 -1 0 0 0 0 0 0 } { 0 -1 0 0 1 0 -1 0 0 0 } { -1 1 0 0 -1 0 0 1 0 0 } { 0 0 -1 1 0 -1 1 -1 0 0 } { 0 0 0 0 1 0 0 0 0 0 } { 0 0 1 0 -1 0 0 0 0 0 } { 0 0 0 -1 1 0 0 0 0 1 } { 1 0 0 0 0 0 0 0 0 0 } { 0 0 0 0 0 0 0 -1 0 0 } }",
-			{},{}),
-};
 }
 }
-
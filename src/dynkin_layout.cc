@@ -0,0 +1,263 @@
+/*
+ * dynkin_layout.cc
+ * Copyright 2014-2015 John Lawson
+ *
+ * This program is free software: you can redistribute it and/or modify
+ * it under the terms of the GNU General Public License as published by
+ * the Free Software Foundation, either version 3 of the License, or
+ * (at your option) any later version.
+ *
+ * This program is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ * GNU General Public License for more details.
+ *
+ * You should have received a copy of the GNU General Public License
+ * along with this program.  If not, see <http://www.gnu.org/licenses/>.
+ */
+#include "dynkin_layout.h"
+
+#include <algorithm>
+#include <cmath>
+
+namespace qvlayout {
+namespace {
+typedef std::vector<std::pair<double, double>> Coords;
+/* Family of the underlying graph, which is None if it is not one of the
+ * Dynkin or affine diagrams. */
+struct Diagram {
+  enum Family { None, A, D, E, AffineA, AffineD, AffineE };
+  Family family;
+  /* Number of vertices, less one for the affine families. */
+  int rank;
+};
+/* Length of an edge in node sizes. */
+const double EDGE_LENGTH = 2;
+const double PI = 3.14159265358979323846;
+/* Underlying graph of a quiver, with an edge wherever there is an arrow. */
+class Shape {
+ public:
+  explicit Shape(const cluster::IntMatrix& matrix)
+      : adjacent_(matrix.num_rows()), edges_(0) {
+    const int n = matrix.num_rows();
+    for (int i = 0; i < n; ++i) {
+      for (int j = i + 1; j < n; ++j) {
+        if (matrix.get(i, j) != 0 || matrix.get(j, i) != 0) {
+          adjacent_[i].push_back(j);
+          adjacent_[j].push_back(i);
+          ++edges_;
+        }
+      }
+    }
+  }
+  int size() const { return adjacent_.size(); }
+  int edges() const { return edges_; }
+  int degree(int v) const { return adjacent_[v].size(); }
+  const std::vector<int>& adjacent(int v) const { return adjacent_[v]; }
+  bool connected() const {
+    std::vector<bool> seen(size(), false);
+    std::vector<int> stack(1, 0);
+    seen[0] = true;
+    int count = 1;
+    while (!stack.empty()) {
+      const int v = stack.back();
+      stack.pop_back();
+      for (int w : adjacent_[v]) {
+        if (!seen[w]) {
+          seen[w] = true;
+          ++count;
+          stack.push_back(w);
+        }
+      }
+    }
+    return count == size();
+  }
+  /*
+   * Vertices met walking from v away from prev, as long as each vertex only
+   * leads on to one other. The last vertex is a leaf or a branch vertex.
+   */
+  std::vector<int> walk(int prev, int v) const {
+    std::vector<int> result(1, v);
+    while (degree(v) == 2) {
+      const int next = adjacent_[v][0] == prev ? adjacent_[v][1]
+                                               : adjacent_[v][0];
+      prev = v;
+      v = next;
+      result.push_back(v);
+      if (v == result[0]) {
+        /* Gone all the way round a cycle. */
+        result.pop_back();
+        break;
+      }
+    }
+    return result;
+  }
+
+ private:
+  std::vector<std::vector<int>> adjacent_;
+  int edges_;
+};
+void place_line(const std::vector<int>& line, double x, double y, double dx,
+                double dy, Coords& coords) {
+  for (size_t i = 0; i < line.size(); ++i) {
+    coords[line[i]] = std::make_pair(x + i * dx, y + i * dy);
+  }
+}
+/* Tree with one branch vertex, as D, E, affine D4 or affine E. */
+Diagram star(const Shape& shape, int centre, Coords* coords) {
+  std::vector<std::vector<int>> arms;
+  for (int w : shape.adjacent(centre)) {
+    arms.push_back(shape.walk(centre, w));
+  }
+  std::sort(arms.begin(), arms.end(),
+            [](const std::vector<int>& a, const std::vector<int>& b) {
+              return a.size() > b.size();
+            });
+  const int n = shape.size();
+  Diagram result{Diagram::None, 0};
+  if (arms.size() == 3) {
+    const size_t r = arms[0].size();
+    const size_t q = arms[1].size();
+    const size_t p = arms[2].size();
+    if (p == 1 && q == 1) {
+      result = Diagram{Diagram::D, n};
+    } else if (p == 1 && q == 2 && r <= 4) {
+      result = Diagram{Diagram::E, n};
+    } else if ((p == 2 && q == 2 && r == 2) || (p == 1 && q == 3 && r == 3) ||
+               (p == 1 && q == 2 && r == 5)) {
+      result = Diagram{Diagram::AffineE, n - 1};
+    }
+  } else if (arms.size() == 4 && arms[0].size() == 1) {
+    result = Diagram{Diagram::AffineD, 4};
+  }
+  if (result.family != Diagram::None && coords != nullptr) {
+    (*coords)[centre] = std::make_pair(0.0, 0.0);
+    place_line(arms[0], -1, 0, -1, 0, *coords);
+    place_line(arms[1], 1, 0, 1, 0, *coords);
+    place_line(arms[2], 0, 1, 0, 1, *coords);
+    if (arms.size() == 4) {
+      place_line(arms[3], 0, -1, 0, -1, *coords);
+    }
+  }
+  return result;
+}
+/*
+ * Tree with two branch vertices, each with two leaves, as affine D. The line
+ * from a leaf of the first to a leaf of the second is drawn straight, and the
+ * other two leaves point up.
+ */
+Diagram two_forks(const Shape& shape, int first, Coords* coords) {
+  std::vector<int> leaves;
+  int along = -1;
+  for (int w : shape.adjacent(first)) {
+    if (shape.degree(w) == 1) {
+      leaves.push_back(w);
+    } else {
+      along = w;
+    }
+  }
+  if (leaves.size() != 2 || along < 0) {
+    return Diagram{Diagram::None, 0};
+  }
+  std::vector<int> middle = shape.walk(first, along);
+  const int second = middle.back();
+  if (shape.degree(second) != 3) {
+    return Diagram{Diagram::None, 0};
+  }
+  const int before = middle.size() > 1 ? middle[middle.size() - 2] : first;
+  for (int w : shape.adjacent(second)) {
+    if (w != before) {
+      if (shape.degree(w) != 1) {
+        return Diagram{Diagram::None, 0};
+      }
+      leaves.push_back(w);
+    }
+  }
+  if (coords != nullptr) {
+    std::vector<int> line(1, leaves[0]);
+    line.push_back(first);
+    line.insert(line.end(), middle.begin(), middle.end());
+    line.push_back(leaves[2]);
+    place_line(line, 0, 0, 1, 0, *coords);
+    (*coords)[leaves[1]] = std::make_pair(1.0, 1.0);
+    (*coords)[leaves[3]] = std::make_pair(line.size() - 2.0, 1.0);
+  }
+  return Diagram{Diagram::AffineD, shape.size() - 1};
+}
+/* Family of the quiver, and if coords is given the positions of the vertices
+ * with edges of unit length. */
+Diagram analyse(const cluster::IntMatrix& matrix, Coords* coords) {
+  const Diagram none{Diagram::None, 0};
+  if (matrix.num_rows() != matrix.num_cols() || matrix.num_rows() == 0) {
+    return none;
+  }
+  Shape shape(matrix);
+  const int n = shape.size();
+  if (!shape.connected()) {
+    return none;
+  }
+  if (coords != nullptr) {
+    coords->assign(n, std::make_pair(0.0, 0.0));
+  }
+  if (n == 1) {
+    return Diagram{Diagram::A, 1};
+  }
+  std::vector<int> branches;
+  int leaf = -1;
+  for (int v = 0; v < n; ++v) {
+    if (shape.degree(v) >= 3) {
+      branches.push_back(v);
+    } else if (shape.degree(v) == 1) {
+      leaf = v;
+    }
+  }
+  if (shape.edges() == n && branches.empty()) {
+    /* Every vertex meets two edges, so the graph is a cycle. */
+    if (coords != nullptr) {
+      const std::vector<int> cycle = shape.walk(0, shape.adjacent(0)[0]);
+      const double radius = 0.5 / std::sin(PI / n);
+      for (int i = 0; i < n; ++i) {
+        const double angle = PI / 2 + 2 * PI * i / n;
+        (*coords)[cycle[i]] = std::make_pair(radius * std::cos(angle),
+                                             radius * std::sin(angle));
+      }
+    }
+    return Diagram{Diagram::AffineA, n - 1};
+  }
+  if (shape.edges() != n - 1) {
+    return none;
+  }
+  if (branches.empty()) {
+    if (coords != nullptr) {
+      std::vector<int> line(1, leaf);
+      const std::vector<int> rest = shape.walk(leaf, shape.adjacent(leaf)[0]);
+      line.insert(line.end(), rest.begin(), rest.end());
+      place_line(line, 0, 0, 1, 0, *coords);
+    }
+    return Diagram{Diagram::A, n};
+  }
+  if (branches.size() == 1) {
+    return star(shape, branches[0], coords);
+  }
+  if (branches.size() == 2 && shape.degree(branches[0]) == 3 &&
+      shape.degree(branches[1]) == 3) {
+    return two_forks(shape, branches[0], coords);
+  }
+  return none;
+}
+}
+bool dynkin_layout(const cluster::IntMatrix& matrix, int size,
+                   std::vector<std::pair<double, double>>& coords) {
+  Coords unit;
+  if (analyse(matrix, &unit).family == Diagram::None) {
+    return false;
+  }
+  const double length = EDGE_LENGTH * size;
+  coords.resize(unit.size());
+  for (size_t i = 0; i < unit.size(); ++i) {
+    coords[i] = std::make_pair(unit[i].first * length,
+                               unit[i].second * length);
+  }
+  return true;
+}
+}
@@ -0,0 +1,144 @@
+/*
+ * fingerprint.cc
+ * Copyright 2014-2015 John Lawson
+ *
+ * This program is free software: you can redistribute it and/or modify
+ * it under the terms of the GNU General Public License as published by
+ * the Free Software Foundation, either version 3 of the License, or
+ * (at your option) any later version.
+ *
+ * This program is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ * GNU General Public License for more details.
+ *
+ * You should have received a copy of the GNU General Public License
+ * along with this program.  If not, see <http://www.gnu.org/licenses/>.
+ */
+#include "fingerprint.h"
+
+#include <string>
+
+namespace qvdraw {
+namespace fingerprint {
+namespace {
+__extension__ typedef unsigned __int128 uint128_t;
+const uint64_t PRIME = (static_cast<uint64_t>(1) << 61) - 1;
+/* Mixed into the value of each symbol, one for each point. */
+const uint64_t SALTS[POINTS] = {0x9e3779b97f4a7c15ULL, 0xc2b2ae3d27d4eb4fULL};
+uint64_t reduce(uint64_t a) {
+  a = (a & PRIME) + (a >> 61);
+  return a >= PRIME ? a - PRIME : a;
+}
+uint64_t add(uint64_t a, uint64_t b) { return reduce(a + b); }
+uint64_t multiply(uint64_t a, uint64_t b) {
+  const uint128_t product = static_cast<uint128_t>(a) * b;
+  const uint64_t low = static_cast<uint64_t>(product) & PRIME;
+  const uint64_t high = static_cast<uint64_t>(product >> 61);
+  return reduce(low + high);
+}
+uint64_t power(uint64_t base, uint64_t exponent) {
+  uint64_t result = 1;
+  while (exponent != 0) {
+    if (exponent & 1) {
+      result = multiply(result, base);
+    }
+    base = multiply(base, base);
+    exponent >>= 1;
+  }
+  return result;
+}
+/* Inverse of a non-zero value, as a^(p - 2) = a^-1 modulo p. */
+uint64_t inverse(uint64_t a) { return power(a, PRIME - 2); }
+/* The value is never zero, as symbols appear in denominators. */
+uint64_t symbol_value(const std::string& name, uint64_t salt) {
+  /* FNV-1a of the name, then the splitmix64 finaliser. */
+  uint64_t result = 0xcbf29ce484222325ULL;
+  for (char c : name) {
+    result = (result ^ static_cast<unsigned char>(c)) * 0x100000001b3ULL;
+  }
+  result ^= salt;
+  result = (result ^ (result >> 30)) * 0xbf58476d1ce4e5b9ULL;
+  result = (result ^ (result >> 27)) * 0x94d049bb133111ebULL;
+  result ^= result >> 31;
+  result = reduce(result & PRIME);
+  return result == 0 ? 1 : result;
+}
+/* Value of an integer modulo the prime, however large it is. */
+uint64_t integer_value(const GiNaC::numeric& num) {
+  static const GiNaC::numeric prime(static_cast<long>(PRIME));
+  return static_cast<uint64_t>(GiNaC::mod(num, prime).to_long());
+}
+bool numeric_value(const GiNaC::numeric& num, Value& result) {
+  if (!num.is_rational()) {
+    return false;
+  }
+  const uint64_t numer = integer_value(num.numer());
+  const uint64_t denom = integer_value(num.denom());
+  if (denom == 0) {
+    return false;
+  }
+  result.fill(multiply(numer, inverse(denom)));
+  return true;
+}
+}
+bool evaluate(const GiNaC::ex& exp, Value& result) {
+  if (GiNaC::is_a<GiNaC::symbol>(exp)) {
+    const std::string& name = GiNaC::ex_to<GiNaC::symbol>(exp).get_name();
+    for (size_t i = 0; i < POINTS; ++i) {
+      result[i] = symbol_value(name, SALTS[i]);
+    }
+    return true;
+  }
+  if (GiNaC::is_a<GiNaC::numeric>(exp)) {
+    return numeric_value(GiNaC::ex_to<GiNaC::numeric>(exp), result);
+  }
+  Value term;
+  if (GiNaC::is_a<GiNaC::add>(exp)) {
+    result.fill(0);
+    for (size_t i = 0; i < exp.nops(); ++i) {
+      if (!evaluate(exp.op(i), term)) {
+        return false;
+      }
+      for (size_t j = 0; j < POINTS; ++j) {
+        result[j] = add(result[j], term[j]);
+      }
+    }
+    return true;
+  }
+  if (GiNaC::is_a<GiNaC::mul>(exp)) {
+    result.fill(1);
+    for (size_t i = 0; i < exp.nops(); ++i) {
+      if (!evaluate(exp.op(i), term)) {
+        return false;
+      }
+      for (size_t j = 0; j < POINTS; ++j) {
+        result[j] = multiply(result[j], term[j]);
+      }
+    }
+    return true;
+  }
+  if (GiNaC::is_a<GiNaC::power>(exp)) {
+    const GiNaC::ex exponent = exp.op(1);
+    if (!GiNaC::is_a<GiNaC::numeric>(exponent) ||
+        !exponent.info(GiNaC::info_flags::integer) ||
+        !evaluate(exp.op(0), result)) {
+      return false;
+    }
+    const long n = GiNaC::ex_to<GiNaC::numeric>(exponent).to_long();
+    for (size_t j = 0; j < POINTS; ++j) {
+      if (n < 0) {
+        if (result[j] == 0) {
+          return false;
+        }
+        result[j] = power(inverse(result[j]), static_cast<uint64_t>(-n));
+      } else {
+        result[j] = power(result[j], n);
+      }
+    }
+    return true;
+  }
+  return false;
+}
+}
+}
@@ -0,0 +1,172 @@
+/*
+ * gml.cc
+ * Copyright 2014-2015 John Lawson
+ *
+ * This program is free software: you can redistribute it and/or modify
+ * it under the terms of the GNU General Public License as published by
+ * the Free Software Foundation, either version 3 of the License, or
+ * (at your option) any later version.
+ *
+ * This program is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ * GNU General Public License for more details.
+ *
+ * You should have received a copy of the GNU General Public License
+ * along with this program.  If not, see <http://www.gnu.org/licenses/>.
+ */
+#include "gml.h"
+
+#include <algorithm>
+#include <ios>
+
+#include "trace.h"
+
+namespace qvdraw {
+namespace gml {
+namespace {
+/* Default size of a node in OGDF. */
+const double NODE_SIZE = 10.0;
+/* Arrow of the quiver, as its end vertices and label. */
+struct Arrow {
+  size_t source;
+  size_t target;
+  std::string label;
+};
+void gml_header(std::ostream& os, const char* creator) {
+  os << "Creator \"" << creator << '"' << os.widen('\n');
+  os << "directed 1" << os.widen('\n');
+  os << "graph [" << os.widen('\n');
+}
+void gml_footer(std::ostream& os) {
+  os << "]" << os.widen('\n');
+}
+void graphml_header(std::ostream& os, bool labels) {
+  os << "<?xml version=\"1.0\" encoding=\"UTF-8\"?>" << os.widen('\n');
+  os << "<graphml xmlns=\"http://graphml.graphdrawing.org/xmlns\">"
+     << os.widen('\n');
+  if (labels) {
+    os << "  <key id=\"label\" for=\"edge\" attr.name=\"label\" "
+          "attr.type=\"string\"/>"
+       << os.widen('\n');
+  }
+  os << "  <graph id=\"G\" edgedefault=\"directed\">" << os.widen('\n');
+}
+void graphml_footer(std::ostream& os) {
+  os << "  </graph>" << os.widen('\n');
+  os << "</graphml>" << os.widen('\n');
+}
+void graphml_node(std::ostream& os, size_t id) {
+  os << "    <node id=\"n" << id << "\"/>" << os.widen('\n');
+}
+void graphml_edge(std::ostream& os, size_t source, size_t target,
+                  const std::string& label) {
+  os << "    <edge source=\"n" << source << "\" target=\"n" << target << '"';
+  if (label.empty()) {
+    os << "/>" << os.widen('\n');
+  } else {
+    os << "><data key=\"label\">" << label << "</data></edge>"
+       << os.widen('\n');
+  }
+}
+}
+std::string edge_label(const cluster::IntMatrix& matrix, int i, int j) {
+  int k = matrix.get(i, j);
+  int k_tra = matrix.get(j, i);
+  if (k != -1 * k_tra) {
+    /* Symmetrisable, so add pair of labels. */
+    if (i < j) {
+      return std::to_string(k) + "," + std::to_string(-1 * k_tra);
+    }
+    return std::to_string(-1 * k_tra) + "," + std::to_string(k);
+  } else if (k != 1) {
+    /* Skew-symmetric, so add single label. */
+    return std::to_string(k);
+  }
+  return std::string();
+}
+void write(std::ostream& os, const cluster::IntMatrix& matrix, Format format) {
+  trace::Scope scope("write gml");
+  const size_t size = std::max(matrix.num_rows(), matrix.num_cols());
+  std::vector<Arrow> arrows;
+  for (int i = 0; i < matrix.num_rows(); ++i) {
+    for (int j = 0; j < matrix.num_cols(); ++j) {
+      if (matrix.get(i, j) > 0) {
+        arrows.push_back({static_cast<size_t>(i), static_cast<size_t>(j),
+                          edge_label(matrix, i, j)});
+      }
+    }
+  }
+  if (format == Format::GraphML) {
+    graphml_header(os, true);
+    for (size_t i = 0; i < size; ++i) {
+      graphml_node(os, i);
+    }
+    for (const Arrow& arrow : arrows) {
+      graphml_edge(os, arrow.source, arrow.target, arrow.label);
+    }
+    graphml_footer(os);
+    return;
+  }
+  const std::ios_base::fmtflags flags = os.flags();
+  const std::streamsize precision = os.precision(10);
+  os.setf(std::ios_base::showpoint);
+  gml_header(os, "ogdf::GraphAttributes::writeGML");
+  for (size_t i = 0; i < size; ++i) {
+    os << "  node [" << os.widen('\n');
+    os << "    id " << i << os.widen('\n');
+    os << "    label \"\"" << os.widen('\n');
+    os << "    graphics [" << os.widen('\n');
+    os << "      x " << 0.0 << os.widen('\n');
+    os << "      y " << 0.0 << os.widen('\n');
+    os << "      w " << NODE_SIZE << os.widen('\n');
+    os << "      h " << NODE_SIZE << os.widen('\n');
+    os << "    ]" << os.widen('\n');
+    os << "  ]" << os.widen('\n');
+  }
+  for (const Arrow& arrow : arrows) {
+    os << "  edge [" << os.widen('\n');
+    os << "    source " << arrow.source << os.widen('\n');
+    os << "    target " << arrow.target << os.widen('\n');
+    os << "    label \"" << arrow.label << '"' << os.widen('\n');
+    os << "    graphics [" << os.widen('\n');
+    os << "      type \"line\"" << os.widen('\n');
+    os << "      arrow \"last\"" << os.widen('\n');
+    os << "    ]" << os.widen('\n');
+    os << "  ]" << os.widen('\n');
+  }
+  gml_footer(os);
+  os.flags(flags);
+  os.precision(precision);
+}
+void write(std::ostream& os, size_t nodes,
+           const std::vector<std::pair<size_t, size_t>>& edges,
+           Format format) {
+  trace::Scope scope("write gml");
+  if (format == Format::GraphML) {
+    graphml_header(os, false);
+    for (size_t i = 0; i < nodes; ++i) {
+      graphml_node(os, i);
+    }
+    for (const auto& edge : edges) {
+      graphml_edge(os, edge.first, edge.second, std::string());
+    }
+    graphml_footer(os);
+    return;
+  }
+  gml_header(os, "ogdf::Graph::writeGML");
+  for (size_t i = 0; i < nodes; ++i) {
+    os << "  node [" << os.widen('\n');
+    os << "    id " << i << os.widen('\n');
+    os << "  ]" << os.widen('\n');
+  }
+  for (const auto& edge : edges) {
+    os << "  edge [" << os.widen('\n');
+    os << "    source " << edge.first << os.widen('\n');
+    os << "    target " << edge.second << os.widen('\n');
+    os << "  ]" << os.widen('\n');
+  }
+  gml_footer(os);
+}
+}
+}
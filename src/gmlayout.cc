@@ -17,29 +17,142 @@
  */
 /**
  * Program to layout a graph provided in GML format. Outputs an updated GML file
- * with the layout information included.
+ * with the layout information included, or a picture of the laid out graph.
  */
 #include <unistd.h>
 
+#include <climits>
+#include <cstdint>
+#include <memory>
+#include <sstream>
+#include <stdexcept>
 #include <string>
+#include <vector>
 
+#include "graph_factory.h"
+#include "incremental.h"
 #include "layout.h"
+#include "layout_cache.h"
+#include "qvb.h"
+#include "render.h"
+#include "trace.h"
  
 void usage() {
-	std::cout << "gmlayout [-i input]" << std::endl;
+	std::cout << "gmlayout [-n] [-i input | -b input] [-t format] [-w width] [-k dir [-K MB]]" << std::endl;
+	std::cout << "         [-A] [-T seconds] [-p previous [-R]]" << std::endl;
 	std::cout << "Layout a graph in GML format in a planar way." << std::endl;
 	std::cout << "  -i Input file to read. Defualt is stdin" << std::endl;
+	std::cout << "  -b Binary qvb file to read instead of GML" << std::endl;
+	std::cout << "  -t Output format, one of gml, svg, png or qvb. Default is gml" << std::endl;
+	std::cout << "  -w Width of png pictures in pixels. Default is 400" << std::endl;
+	std::cout << "  -n Do not draw arrows on the edges" << std::endl;
+	std::cout << "  -k Directory to cache quiver layouts in" << std::endl;
+	std::cout << "  -K Size limit of the layout cache in megabytes" << std::endl;
+	std::cout << "  -A Choose the layout quality from the size of the graph" << std::endl;
+	std::cout << "  -T Refine the layout for up to this many seconds (implies -A, not with -k)" << std::endl;
+	std::cout << "  -p GML or qvb file of an earlier layout of part of the graph. Only the" << std::endl;
+	std::cout << "     nodes which are not in it are laid out (not with -A, -T or -k)" << std::endl;
+	std::cout << "  -R Relax the whole layout after placing the new nodes of -p" << std::endl;
+}
+
+/* Read a whole number from 1 up to max, returning false for anything else. */
+bool parse_number(const char* str, size_t& result, size_t max = SIZE_MAX) {
+	if(str[0] == '-') {
+		return false;
+	}
+	try {
+		size_t used = 0;
+		result = std::stoul(str, &used);
+		return used > 0 && str[used] == '\0' && result >= 1 && result <= max;
+	} catch(const std::logic_error&) {
+		return false;
+	}
+}
+/* Read a number of seconds which is not negative. */
+bool parse_number(const char* str, double& result) {
+	try {
+		size_t used = 0;
+		result = std::stod(str, &used);
+		return used > 0 && str[used] == '\0' && result >= 0;
+	} catch(const std::logic_error&) {
+		return false;
+	}
 }
 
 int main(int argc, char* argv[]) {
+	qvdraw::trace::init(argc, argv);
 	std::string str;
+	std::string binary_in;
+	bool binary_out = false;
+	qvdraw::render::Format format = qvdraw::render::Format::GML;
+	qvdraw::render::Style style;
+	std::string cache_dir;
+	size_t cache_bytes = qvlayout::LayoutCache::DEFAULT_MAX_BYTES;
+	qvlayout::Method method = qvlayout::Method::Energy;
+	double budget = 0;
+	bool timed = false;
+	std::string previous;
+	bool fixed = true;
+	size_t number;
 	int c;
 
-	while((c = getopt(argc, argv, "i:")) != -1) {
+	while((c = getopt(argc, argv, "i:b:t:w:nk:K:AT:p:R")) != -1) {
 		switch(c) {
 			case 'i':
 				str = optarg;
 				break;
+			case 'b':
+				binary_in = optarg;
+				break;
+			case 't':
+				if(std::string(optarg) == "qvb") {
+					binary_out = true;
+					break;
+				}
+				try {
+					format = qvdraw::render::format(optarg);
+				} catch(const std::invalid_argument& e) {
+					std::cerr << e.what() << std::endl;
+					return 1;
+				}
+				break;
+			case 'w':
+				if(!parse_number(optarg, number, INT_MAX)) {
+					usage();
+					return 1;
+				}
+				style.width = number;
+				break;
+			case 'n':
+				style.arrows = false;
+				break;
+			case 'k':
+				cache_dir = optarg;
+				break;
+			case 'K':
+				if(!parse_number(optarg, cache_bytes, SIZE_MAX / (1024 * 1024))) {
+					usage();
+					return 1;
+				}
+				cache_bytes *= 1024 * 1024;
+				break;
+			case 'A':
+				method = qvlayout::Method::Auto;
+				break;
+			case 'T':
+				method = qvlayout::Method::Auto;
+				if(!parse_number(optarg, budget)) {
+					usage();
+					return 1;
+				}
+				timed = true;
+				break;
+			case 'p':
+				previous = optarg;
+				break;
+			case 'R':
+				fixed = false;
+				break;
 			case '?':
 				usage();
 				break;
@@ -48,26 +161,100 @@ int main(int argc, char* argv[]) {
 				break;
 		}
 	}
+	/* An earlier layout is extended with fixed settings and without the cache,
+	 * and a cached layout has no time budget to refine it in. */
+	if(!previous.empty() &&
+			(method == qvlayout::Method::Auto || !cache_dir.empty())) {
+		std::cerr << "-p cannot be used with -A, -T or -k" << std::endl;
+		return 1;
+	}
+	if(timed && !cache_dir.empty()) {
+		std::cerr << "-T cannot be used with -k" << std::endl;
+		return 1;
+	}
 	typedef ogdf::Graph Graph;
 	typedef ogdf::GraphAttributes GraphA;
 
-	Graph G;
-	GraphA GA(G);
-	GA.initAttributes(ogdf::GraphAttributes::edgeLabel);
-	GA.initAttributes(ogdf::GraphAttributes::nodeLabel);
-	if(str.empty()) {
-		if(!GA.readGML(G, std::cin)) {
-			std::cerr << "Error reading GML from stdin" << std::endl;
+	std::shared_ptr<Graph> graph = std::make_shared<Graph>();
+	std::shared_ptr<GraphA> attr = std::make_shared<GraphA>(*graph);
+	/* Quivers of the nodes of a binary graph, kept to write back out. */
+	std::vector<cluster::IntMatrix> quivers;
+	std::vector<const cluster::IntMatrix*> quiver_ptrs;
+	/* Keys to match nodes against an earlier layout. */
+	std::vector<std::string> keys;
+	if(!binary_in.empty()) {
+		try {
+			qvdraw::qvb::MappedGraph mapped(binary_in);
+			auto pair = qvdraw::graph_factory::graph(mapped);
+			graph = pair.first;
+			attr = pair.second;
+			if(binary_out) {
+				quivers.reserve(mapped.size());
+				for(size_t i = 0; i < mapped.size(); ++i) {
+					quivers.push_back(mapped.matrix(i));
+					quiver_ptrs.push_back(mapped.has_matrix(i) ? &quivers.back() : nullptr);
+				}
+			}
+			if(!previous.empty()) {
+				keys.reserve(mapped.size());
+				for(size_t i = 0; i < mapped.size(); ++i) {
+					std::ostringstream key;
+					if(mapped.has_matrix(i)) {
+						key << mapped.matrix(i);
+					}
+					keys.push_back(key.str());
+				}
+			}
+		} catch(const std::runtime_error& e) {
+			std::cerr << e.what() << std::endl;
+			return 1;
 		}
 	} else {
-		if(!GA.readGML(G, str.data())) {
-			std::cerr << "Could not load " << str << std::endl;
+		attr->initAttributes(ogdf::GraphAttributes::edgeLabel);
+		attr->initAttributes(ogdf::GraphAttributes::nodeLabel);
+		if(str.empty()) {
+			if(!attr->readGML(*graph, std::cin)) {
+				std::cerr << "Error reading GML from stdin" << std::endl;
+			}
+		} else {
+			if(!attr->readGML(*graph, str.data())) {
+				std::cerr << "Could not load " << str << std::endl;
+				return 1;
+			}
+		}
+	}
+	Graph& G = *graph;
+	GraphA& GA = *attr;
+	if(!previous.empty()) {
+		if(keys.empty()) {
+			keys = qvlayout::label_keys(G, GA);
+		}
+		try {
+			qvlayout::PreviousLayout prev = qvlayout::read_previous(previous);
+			std::vector<bool> known = qvlayout::place_known(prev, keys, G, GA);
+			std::cerr << qvlayout::extend(G, GA, known, 10, fixed) << std::endl;
+		} catch(const std::runtime_error& e) {
+			std::cerr << e.what() << std::endl;
 			return 1;
 		}
+	} else if(cache_dir.empty() && method == qvlayout::Method::Auto) {
+		std::cerr << qvlayout::layout_auto(G, GA, 10, budget) << std::endl;
+	} else if(cache_dir.empty()) {
+		qvlayout::layout(G, GA);
+	} else {
+		/* The graph is assumed to be a quiver, as written by qv2gml. */
+		qvlayout::LayoutCache cache(cache_dir, cache_bytes);
+		qvlayout::layout(qvdraw::graph_factory::matrix(G, GA), G, GA, 10,
+				method, &cache);
+		cache.report(std::cerr);
 	}
-	qvlayout::layout(G, GA);
 
-	GA.writeGML(std::cout); 
+	if(binary_out) {
+		qvdraw::graph_factory::binary(G, GA,
+				quiver_ptrs.empty() ? nullptr : &quiver_ptrs).write(std::cout);
+	} else {
+		qvdraw::render::write(format, std::cout, G, GA, style);
+	}
  
 	return 0;
 }
@@ -21,7 +21,10 @@
  */
 #include "graph_factory.h"
 
+#include <algorithm>
 #include <iostream>
+#include <map>
+#include <mutex>
 #include <sstream>
 #include <vector>
 
@@ -31,47 +34,173 @@
 #include "qv/template_exchange_graph.h"
 #include "qv/green_exchange_graph.h"
 
+#include "csr_graph.h"
+#include "fingerprint.h"
+#include "gml.h"
+#include "parallel_explore.h"
+#include "trace.h"
+
 namespace qvdraw {
 namespace graph_factory {
 namespace {
 const size_t MAX_EQ_LENGTH = 100;
-template <class K>
-ogdf::node get_node(ogdf::Graph& res, K* const mat, ReverseNodeMap<K>& map) {
-  if (mat == nullptr) {
-    return res.newNode();
+/* How tightly an expression is bound to its neighbours, to decide whether it
+ * needs brackets: a sum inside a product, or a product or sum in a base. */
+enum Level { SUM, PRODUCT, BASE };
+void write_latex(std::ostream& os, const GiNaC::ex& exp, Level level);
+/* Whether the factor of a product is a power with a negative exponent, so
+ * belongs in the denominator. */
+bool in_denominator(const GiNaC::ex& factor) {
+  return GiNaC::is_a<GiNaC::power>(factor) &&
+         GiNaC::is_a<GiNaC::numeric>(factor.op(1)) &&
+         GiNaC::ex_to<GiNaC::numeric>(factor.op(1)).is_negative();
+}
+/* Write base^exponent, leaving out an exponent of 1. */
+void write_power(std::ostream& os, const GiNaC::ex& base,
+                 const GiNaC::ex& exponent) {
+  write_latex(os, base, BASE);
+  if (!GiNaC::is_a<GiNaC::numeric>(exponent) ||
+      !GiNaC::ex_to<GiNaC::numeric>(exponent).is_equal(1)) {
+    os << "^{";
+    write_latex(os, exponent, SUM);
+    os << '}';
   }
-  auto find = map.find(mat);
-  if (find == map.end()) {
-    ogdf::node new_node = res.newNode();
-    map.insert(std::make_pair(mat, new_node));
-    return new_node;
+}
+/* Write the denominator factor base^-n as base^n. */
+void write_inverse(std::ostream& os, const GiNaC::ex& factor) {
+  write_power(os, factor.op(0),
+              GiNaC::abs(GiNaC::ex_to<GiNaC::numeric>(factor.op(1))));
+}
+/* Coefficient of the product, which GiNaC keeps as its last operand. */
+bool has_coefficient(const GiNaC::ex& exp) {
+  return GiNaC::is_a<GiNaC::mul>(exp) && exp.nops() > 0 &&
+         GiNaC::is_a<GiNaC::numeric>(exp.op(exp.nops() - 1));
+}
+/* Whether the term of a sum is written with a minus sign. */
+bool negative_term(const GiNaC::ex& term) {
+  if (GiNaC::is_a<GiNaC::numeric>(term)) {
+    return GiNaC::ex_to<GiNaC::numeric>(term).is_negative();
   }
-  return find->second;
+  return has_coefficient(term) &&
+         GiNaC::ex_to<GiNaC::numeric>(term.op(term.nops() - 1)).is_negative();
 }
-template <class T>
-NodeMap<T> switch_map(const ReverseNodeMap<T>& map) {
-  NodeMap<T> result;
-  for (auto it = map.begin(); it != map.end(); ++it) {
-    result.insert(std::make_pair(it->second, it->first));
+/* Write a product as its numerator and, if any, its denominator as a
+ * fraction, with the coefficient in front. */
+void write_product(std::ostream& os, const GiNaC::ex& exp) {
+  std::ostringstream top;
+  std::ostringstream bottom;
+  size_t factors = exp.nops();
+  if (has_coefficient(exp)) {
+    const GiNaC::numeric coeff =
+        GiNaC::ex_to<GiNaC::numeric>(exp.op(--factors));
+    if (coeff.is_negative()) {
+      top << '-';
+    }
+    if (!coeff.is_equal(1) && !coeff.is_equal(-1)) {
+      top << GiNaC::abs(coeff) << ' ';
+    }
+  }
+  bool first_top = true;
+  bool first_bottom = true;
+  for (size_t i = 0; i < factors; ++i) {
+    const GiNaC::ex factor = exp.op(i);
+    if (in_denominator(factor)) {
+      bottom << (first_bottom ? "" : " ");
+      write_inverse(bottom, factor);
+      first_bottom = false;
+    } else {
+      top << (first_top ? "" : " ");
+      write_latex(top, factor, PRODUCT);
+      first_top = false;
+    }
+  }
+  if (first_bottom) {
+    os << top.str();
+  } else {
+    os << "\\frac{" << (first_top ? "1" : "") << top.str() << "}{"
+       << bottom.str() << '}';
+  }
+}
+/* Write the expression as LaTeX, working down its tree of sums, products and
+ * powers. */
+void write_latex(std::ostream& os, const GiNaC::ex& exp, Level level) {
+  if (GiNaC::is_a<GiNaC::symbol>(exp)) {
+    os << GiNaC::ex_to<GiNaC::symbol>(exp).get_name();
+  } else if (GiNaC::is_a<GiNaC::numeric>(exp)) {
+    const bool bracket =
+        level != SUM && (GiNaC::ex_to<GiNaC::numeric>(exp).is_negative() ||
+                         !GiNaC::ex_to<GiNaC::numeric>(exp).is_integer());
+    os << (bracket ? "(" : "") << exp << (bracket ? ")" : "");
+  } else if (GiNaC::is_a<GiNaC::add>(exp)) {
+    os << (level != SUM ? "(" : "");
+    for (size_t i = 0; i < exp.nops(); ++i) {
+      const GiNaC::ex term = exp.op(i);
+      if (negative_term(term)) {
+        os << '-';
+        write_latex(os, -term, PRODUCT);
+      } else {
+        os << (i == 0 ? "" : "+");
+        write_latex(os, term, PRODUCT);
+      }
+    }
+    os << (level != SUM ? ")" : "");
+  } else if (GiNaC::is_a<GiNaC::mul>(exp)) {
+    os << (level == BASE ? "(" : "");
+    write_product(os, exp);
+    os << (level == BASE ? ")" : "");
+  } else if (in_denominator(exp)) {
+    os << "\\frac{1}{";
+    write_inverse(os, exp);
+    os << '}';
+  } else if (GiNaC::is_a<GiNaC::power>(exp)) {
+    write_power(os, exp.op(0), exp.op(1));
+  } else {
+    /* Cluster variables are Laurent polynomials, so there is nothing else. */
+    os << '(' << exp << ')';
   }
-  return std::move(result);
 }
-std::string latexify(const GiNaC::ex& exp) {
+/*
+ * The label of a cluster variable is the fraction of the factors of its
+ * product, with the powers with negative exponents making up the denominator.
+ * Once the numerator is too long to be shown the rest of its factors are
+ * skipped, and it is left empty.
+ */
+std::string format(const GiNaC::ex& exp) {
   std::string top, bottom;
-  std::stringstream ss;
-  ss << exp;
-  std::string var;
-  while (std::getline(ss, var, '*')) {
-    size_t hat_pos = var.find("^(");
-    if (hat_pos == std::string::npos) {
-      top.append(" ").append(var);
+  std::ostringstream part;
+  auto add = [&part](std::string& side) {
+    side.append(" ").append(part.str());
+    part.str(std::string());
+  };
+  if (!GiNaC::is_a<GiNaC::mul>(exp)) {
+    if (in_denominator(exp)) {
+      write_inverse(part, exp);
+      add(bottom);
     } else {
-      bottom.append(" ").append(var.substr(0, hat_pos));
-      size_t min_pos = var.find('-');
-      size_t end_pos = var.find(')');
-      std::string exponent = var.substr(min_pos + 1, end_pos - min_pos - 1);
-      if (exponent != "1") {
-        bottom.append("^").append(exponent);
+      write_latex(part, exp, PRODUCT);
+      add(top);
+    }
+  } else {
+    size_t factors = exp.nops();
+    if (has_coefficient(exp)) {
+      const GiNaC::numeric coeff =
+          GiNaC::ex_to<GiNaC::numeric>(exp.op(--factors));
+      if (!coeff.is_equal(1)) {
+        part << (coeff.is_negative() ? "-" : "");
+        if (!coeff.is_equal(-1)) {
+          part << GiNaC::abs(coeff);
+        }
+        add(top);
+      }
+    }
+    for (size_t i = 0; i < factors; ++i) {
+      const GiNaC::ex factor = exp.op(i);
+      if (in_denominator(factor)) {
+        write_inverse(part, factor);
+        add(bottom);
+      } else if (top.length() <= MAX_EQ_LENGTH) {
+        write_latex(part, factor, PRODUCT);
+        add(top);
       }
     }
   }
@@ -80,6 +209,90 @@ std::string latexify(const GiNaC::ex& exp) {
   }
   return "\\frac{" + top + "}{" + bottom + "}";
 }
+/*
+ * Most cluster variables appear in many seeds, so each is only formatted once.
+ * Vertex graphs are built on several threads, so the cache is locked while it
+ * is used, which also keeps its GiNaC expressions to one thread at a time.
+ * Entries of a std::map do not move, so the label stays valid once unlocked.
+ */
+const std::string& latexify(const GiNaC::ex& exp) {
+  static std::mutex mutex;
+  static std::map<GiNaC::ex, std::string, GiNaC::ex_is_less> labels;
+  std::lock_guard<std::mutex> lock(mutex);
+  auto found = labels.find(exp);
+  if (found == labels.end()) {
+    found = labels.emplace(exp, format(exp)).first;
+  }
+  return found->second;
+}
+/*
+ * Fingerprints of the cluster variables of the seed, sorted unless the seed is
+ * labelled, as then the order of its vertices does not matter. Empty if any of
+ * them cannot be evaluated.
+ */
+template <class M>
+std::vector<fingerprint::Value> fingerprints(const cluster::__Seed<M>& seed,
+                                             bool labelled) {
+  std::vector<fingerprint::Value> result(seed.size());
+  for (size_t i = 0; i < result.size(); ++i) {
+    if (!fingerprint::evaluate(seed.cluster()[i], result[i])) {
+      return std::vector<fingerprint::Value>();
+    }
+  }
+  if (!labelled) {
+    std::sort(result.begin(), result.end());
+  }
+  return result;
+}
+/*
+ * Equal seeds have equal cluster variables, so the same fingerprints, and
+ * only need to be compared symbolically when the fingerprints match. A seed
+ * can only fail to be evaluated if an equal one also fails, as equal GiNaC
+ * expressions have the same form, so libqv's hash is used for those.
+ */
+template <class M>
+size_t seed_hash(const cluster::__Seed<M>& seed,
+                 const std::vector<fingerprint::Value>& prints) {
+  if (prints.empty()) {
+    return seed.hash();
+  }
+  size_t result = 0;
+  for (const fingerprint::Value& value : prints) {
+    for (uint64_t point : value) {
+      result = 31 * result + point;
+    }
+  }
+  return result;
+}
+template <class M>
+bool seed_equals(const cluster::__Seed<M>& lhs, const cluster::__Seed<M>& rhs,
+                 const std::vector<fingerprint::Value>& left,
+                 const std::vector<fingerprint::Value>& right) {
+  trace::count(trace::EqualityCalls);
+  const bool fingerprinted = !left.empty() && !right.empty();
+  if (fingerprinted && left != right) {
+    trace::count(trace::HashCollisions);
+    return false;
+  }
+  const bool result = lhs.equals(rhs);
+  if (!result) {
+    trace::count(trace::HashCollisions);
+  }
+  if (fingerprinted) {
+    trace::count(trace::FingerprintMatches);
+    if (!result) {
+      trace::count(trace::FingerprintFalsePositives);
+    }
+  }
+  return result;
+}
+int parse_weight(const std::string& str, int fallback) {
+  try {
+    return std::stoi(str);
+  } catch (const std::exception&) {
+    return fallback;
+  }
+}
 }  // anonymous namespace
 std::pair<std::shared_ptr<ogdf::Graph>, std::shared_ptr<ogdf::GraphAttributes>>
 graph(const cluster::IntMatrix& matrix) {
@@ -106,20 +319,9 @@ graph(const cluster::IntMatrix& matrix) {
       int k = matrix.get(i, j);
       if (k > 0) {
         ogdf::edge e = graph->searchEdge(nodes[i], nodes[j]);
-        int k_tra = matrix.get(j, i);
-        if (k != -1 * k_tra) {
-          /* Symmetrisable, so add pair of labels. */
-          std::string l;
-          if (i < j) {
-            l = std::to_string(k) + "," + std::to_string(-1 * k_tra);
-          } else {
-            l = std::to_string(-1 * k_tra) + "," + std::to_string(k);
-          }
+        std::string l = gml::edge_label(matrix, i, j);
+        if (!l.empty()) {
           attr->labelEdge(e) = ogdf::String(l.length(), l.c_str());
-        } else if (k != 1 && k == -1 * k_tra) {
-          /* Skew-symmetric, so add single label. */
-          std::string lab = std::to_string(k);
-          attr->labelEdge(e) = ogdf::String(lab.length(), lab.c_str());
         }
       }
     }
@@ -128,6 +330,119 @@ graph(const cluster::IntMatrix& matrix) {
                         std::shared_ptr<ogdf::GraphAttributes>>(
       std::move(graph), std::move(attr));
 }
+cluster::IntMatrix matrix(const ogdf::Graph& graph,
+                          const ogdf::GraphAttributes& attr) {
+  ogdf::NodeArray<int> pos(graph);
+  int size = 0;
+  ogdf::node n;
+  forall_nodes(n, graph) { pos[n] = size++; }
+  cluster::IntMatrix result(size, size);
+  const bool labels =
+      (attr.attributes() & ogdf::GraphAttributes::edgeLabel) != 0;
+  ogdf::edge e;
+  forall_edges(e, graph) {
+    int i = pos[e->source()];
+    int j = pos[e->target()];
+    int ij = 1;
+    int ji = -1;
+    std::string label;
+    if (labels) {
+      std::stringstream ss;
+      ss << attr.labelEdge(e);
+      label = ss.str();
+    }
+    /* Cartan quivers mark their edges with a trailing '-'. */
+    if (!label.empty() && label.back() == '-') {
+      label.pop_back();
+    }
+    if (!label.empty()) {
+      size_t comma = label.find(',');
+      if (comma == std::string::npos) {
+        ij = parse_weight(label, 1);
+        ji = -ij;
+      } else {
+        int first = parse_weight(label.substr(0, comma), 1);
+        int second = parse_weight(label.substr(comma + 1), 1);
+        if (i < j) {
+          ij = first;
+          ji = -second;
+        } else {
+          ji = -first;
+          ij = second;
+        }
+      }
+    }
+    result.set(i, j, ij);
+    result.set(j, i, ji);
+  }
+  return result;
+}
+std::pair<std::shared_ptr<ogdf::Graph>, std::shared_ptr<ogdf::GraphAttributes>>
+graph(const qvb::MappedGraph& mapped) {
+  std::shared_ptr<ogdf::Graph> graph = std::make_shared<ogdf::Graph>();
+  std::vector<ogdf::node> nodes(mapped.size());
+  for (size_t i = 0; i < mapped.size(); ++i) {
+    nodes[i] = graph->newNode();
+  }
+  std::vector<ogdf::edge> edges(mapped.num_edges());
+  for (size_t i = 0; i < mapped.size(); ++i) {
+    for (size_t e = mapped.offset(i); e < mapped.offset(i + 1); ++e) {
+      edges[e] = graph->newEdge(nodes[i], nodes[mapped.target(e)]);
+    }
+  }
+  std::shared_ptr<ogdf::GraphAttributes> attr =
+      std::make_shared<ogdf::GraphAttributes>(*graph);
+  attr->initAttributes(ogdf::GraphAttributes::edgeLabel);
+  attr->initAttributes(ogdf::GraphAttributes::nodeLabel);
+  for (size_t i = 0; i < mapped.size(); ++i) {
+    std::string label = mapped.node_label(i);
+    if (!label.empty()) {
+      attr->labelNode(nodes[i]) = ogdf::String(label.length(), label.c_str());
+    }
+    if (mapped.has_coordinates()) {
+      attr->x(nodes[i]) = mapped.x(i);
+      attr->y(nodes[i]) = mapped.y(i);
+    }
+  }
+  for (size_t e = 0; e < mapped.num_edges(); ++e) {
+    std::string label = mapped.edge_label(e);
+    if (!label.empty()) {
+      attr->labelEdge(edges[e]) = ogdf::String(label.length(), label.c_str());
+    }
+  }
+  return std::make_pair(std::move(graph), std::move(attr));
+}
+qvb::Builder binary(const ogdf::Graph& graph,
+                    const ogdf::GraphAttributes& attr,
+                    const std::vector<const cluster::IntMatrix*>* quivers) {
+  const bool node_labels =
+      (attr.attributes() & ogdf::GraphAttributes::nodeLabel) != 0;
+  const bool edge_labels =
+      (attr.attributes() & ogdf::GraphAttributes::edgeLabel) != 0;
+  qvb::Builder result;
+  ogdf::NodeArray<size_t> pos(graph);
+  ogdf::node n;
+  forall_nodes(n, graph) {
+    std::string label;
+    if (node_labels) {
+      label = attr.labelNode(n).cstr();
+    }
+    const cluster::IntMatrix* quiver =
+        quivers != nullptr ? (*quivers)[n->index()] : nullptr;
+    pos[n] = quiver != nullptr ? result.add_node(*quiver, label)
+                               : result.add_node(label);
+    result.set_position(pos[n], attr.x(n), attr.y(n));
+  }
+  ogdf::edge e;
+  forall_edges(e, graph) {
+    std::string label;
+    if (edge_labels) {
+      label = attr.labelEdge(e).cstr();
+    }
+    result.add_edge(pos[e->source()], pos[e->target()], label);
+  }
+  return result;
+}
 template <class M>
 std::pair<std::shared_ptr<ogdf::Graph>, std::shared_ptr<ogdf::GraphAttributes>>
 graph(const cluster::__Seed<M>& seed) {
@@ -135,15 +450,23 @@ graph(const cluster::__Seed<M>& seed) {
   std::shared_ptr<ogdf::GraphAttributes> attr = result.second;
   const typename cluster::__Seed<M>::Cluster& cluster = seed.cluster();
   ogdf::node n;
-  std::stringstream ss;
   forall_nodes(n, *result.first) {
-    /* Is there a better way of getting the string form of the cluster
-     * variables? */
     attr->labelNode(n) = latexify(cluster[n->index()]).c_str();
   }
   return result;
 }
 std::pair<std::shared_ptr<ogdf::Graph>, std::shared_ptr<ogdf::GraphAttributes>>
+graph(const GVectorSeed& seed) {
+  auto result = graph(seed.matrix());
+  std::shared_ptr<ogdf::GraphAttributes> attr = result.second;
+  ogdf::node n;
+  forall_nodes(n, *result.first) {
+    std::string label = seed.label(n->index());
+    attr->labelNode(n) = ogdf::String(label.length(), label.c_str());
+  }
+  return result;
+}
+std::pair<std::shared_ptr<ogdf::Graph>, std::shared_ptr<ogdf::GraphAttributes>>
 graph(const refl::cartan_exchange::CartanQuiver& seed) {
   auto result = graph(seed.quiver);
   std::shared_ptr<ogdf::GraphAttributes> attr = result.second;
@@ -163,18 +486,14 @@ graph(const refl::cartan_exchange::CartanQuiver& seed) {
 }
 template <class NodeType, class G>
 GraphPair<NodeType> multi_graph(const G& g) {
-  ogdf::Graph result;
-  ReverseNodeMap<NodeType> map;
-  for (auto iter = g.begin(); iter != g.end(); ++iter) {
-    ogdf::node node = get_node(result, iter->first, map);
-    for (auto link_iter = (iter->second).begin();
-         link_iter != (iter->second).end(); ++link_iter) {
-      ogdf::node linked = get_node(result, *link_iter, map);
-      result.newEdge(node, linked);
-    }
+  CsrGraph<NodeType> csr(g);
+  GraphPair<NodeType> result;
+  ogdf_graph(csr, result.first);
+  ogdf::node node;
+  forall_nodes(node, result.first) {
+    result.second.emplace(node, csr.node(node->index()));
   }
-  NodeMap<NodeType> map_result = switch_map(map);
-  return {result, map_result};
+  return result;
 }
 template GraphPair<const cluster::EquivQuiverMatrix>
 multi_graph<const cluster::EquivQuiverMatrix>(
@@ -197,6 +516,12 @@ template GraphPair<const cluster::LabelledSeed> multi_graph(
     const cluster::GreenLabelledExchangeGraph&);
 template GraphPair<const refl::cartan_exchange::CartanQuiver> multi_graph(
     const refl::CartanExchangeGraph&);
+template GraphPair<const cluster::QuiverMatrix> multi_graph(
+    const explore::ExploredGraph<cluster::QuiverMatrix>&);
+template GraphPair<const cluster::EquivQuiverMatrix> multi_graph(
+    const explore::ExploredGraph<cluster::EquivQuiverMatrix>&);
+template GraphPair<const GVectorSeed> multi_graph(
+    const explore::ExploredGraph<GVectorSeed>&);
 template std::pair<std::shared_ptr<ogdf::Graph>,
                    std::shared_ptr<ogdf::GraphAttributes>>
 graph(const cluster::Seed&);
@@ -209,12 +534,39 @@ bool NodeEquals<refl::cartan_exchange::CartanQuiver const*>::operator()(
     refl::cartan_exchange::CartanQuiver const* const& lhs,
     refl::cartan_exchange::CartanQuiver const* const& rhs) const {
   refl::cartan_exchange::Equal equals;
-  return equals(lhs, rhs);
+  const bool result = equals(lhs, rhs);
+  trace::count(trace::EqualityCalls);
+  if (!result) {
+    trace::count(trace::HashCollisions);
+  }
+  return result;
+}
+template <>
+bool NodeEquals<const cluster::Seed*>::operator()(
+    const cluster::Seed* const& lhs, const cluster::Seed* const& rhs) const {
+  return graph_factory::seed_equals(*lhs, *rhs,
+                                    graph_factory::fingerprints(*lhs, false),
+                                    graph_factory::fingerprints(*rhs, false));
+}
+template <>
+bool NodeEquals<const cluster::LabelledSeed*>::operator()(
+    const cluster::LabelledSeed* const& lhs,
+    const cluster::LabelledSeed* const& rhs) const {
+  return graph_factory::seed_equals(*lhs, *rhs,
+                                    graph_factory::fingerprints(*lhs, true),
+                                    graph_factory::fingerprints(*rhs, true));
 }
 template <class NodeType>
 bool NodeEquals<NodeType>::operator()(const NodeType& lhs,
                                       const NodeType& rhs) const {
-  return lhs->equals(*rhs);
+  /* The maps compare the stored hashes first, so two vertices which reach
+   * here and are not equal have the same hash. */
+  const bool result = lhs->equals(*rhs);
+  trace::count(trace::EqualityCalls);
+  if (!result) {
+    trace::count(trace::HashCollisions);
+  }
+  return result;
 }
 template <>
 size_t NodeHash<refl::cartan_exchange::CartanQuiver const*>::operator()(
@@ -222,10 +574,46 @@ size_t NodeHash<refl::cartan_exchange::CartanQuiver const*>::operator()(
   refl::cartan_exchange::Hash hash;
   return hash(node);
 }
+template <>
+size_t NodeHash<const cluster::Seed*>::operator()(
+    const cluster::Seed* const& node) const {
+  return graph_factory::seed_hash(*node,
+                                  graph_factory::fingerprints(*node, false));
+}
+template <>
+size_t NodeHash<const cluster::LabelledSeed*>::operator()(
+    const cluster::LabelledSeed* const& node) const {
+  return graph_factory::seed_hash(*node,
+                                  graph_factory::fingerprints(*node, true));
+}
 template <class NodeType>
 size_t NodeHash<NodeType>::operator()(const NodeType& node) const {
   return node->hash();
 }
+template <>
+NodeKey<const cluster::Seed*>::NodeKey(const cluster::Seed* n)
+    : node(n), prints(graph_factory::fingerprints(*n, false)) {
+  hash = graph_factory::seed_hash(*n, prints);
+}
+template <>
+NodeKey<const cluster::LabelledSeed*>::NodeKey(const cluster::LabelledSeed* n)
+    : node(n), prints(graph_factory::fingerprints(*n, true)) {
+  hash = graph_factory::seed_hash(*n, prints);
+}
+template <>
+bool NodeKeyEquals<const cluster::Seed*>::operator()(
+    const NodeKey<const cluster::Seed*>& lhs,
+    const NodeKey<const cluster::Seed*>& rhs) const {
+  return graph_factory::seed_equals(*lhs.node, *rhs.node, lhs.prints,
+                                    rhs.prints);
+}
+template <>
+bool NodeKeyEquals<const cluster::LabelledSeed*>::operator()(
+    const NodeKey<const cluster::LabelledSeed*>& lhs,
+    const NodeKey<const cluster::LabelledSeed*>& rhs) const {
+  return graph_factory::seed_equals(*lhs.node, *rhs.node, lhs.prints,
+                                    rhs.prints);
+}
 bool ogdfnodeEquals::operator()(const ogdf::node& lhs,
                                 const ogdf::node& rhs) const {
   return lhs == rhs;
@@ -233,4 +621,10 @@ bool ogdfnodeEquals::operator()(const ogdf::node& lhs,
 size_t ogdfnodeHash::operator()(const ogdf::node& node) const {
   return (size_t)node;
 }
+template struct NodeEquals<const cluster::EquivQuiverMatrix*>;
+template struct NodeEquals<const cluster::QuiverMatrix*>;
+template struct NodeEquals<const GVectorSeed*>;
+template struct NodeHash<const cluster::EquivQuiverMatrix*>;
+template struct NodeHash<const cluster::QuiverMatrix*>;
+template struct NodeHash<const GVectorSeed*>;
 }
@@ -0,0 +1,192 @@
+/*
+ * gvector_seed.cc
+ * Copyright 2014-2015 John Lawson
+ *
+ * This program is free software: you can redistribute it and/or modify
+ * it under the terms of the GNU General Public License as published by
+ * the Free Software Foundation, either version 3 of the License, or
+ * (at your option) any later version.
+ *
+ * This program is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ * GNU General Public License for more details.
+ *
+ * You should have received a copy of the GNU General Public License
+ * along with this program.  If not, see <http://www.gnu.org/licenses/>.
+ */
+#include "gvector_seed.h"
+
+#include <algorithm>
+#include <cstdint>
+#include <cstdlib>
+#include <sstream>
+#include <stdexcept>
+
+namespace qvdraw {
+namespace {
+/* Change to an entry of a mutated matrix, with a = b_ik and b = b_kj. */
+int exchange(int a, int b) {
+  return (std::abs(a) * b + a * std::abs(b)) / 2;
+}
+int positive(int a) { return a > 0 ? a : 0; }
+/* Mixed well enough that the hashes can be added together for unlabelled
+ * seeds. */
+size_t hash_vector(const int* vec, size_t size) {
+  uint64_t result = 113;
+  for (size_t i = 0; i < size; ++i) {
+    result = 31 * result + static_cast<uint64_t>(vec[i]);
+  }
+  result ^= result >> 33;
+  result *= 0xff51afd7ed558ccdULL;
+  result ^= result >> 33;
+  return result;
+}
+cluster::IntMatrix columns(const std::vector<int>& vectors, size_t size) {
+  cluster::IntMatrix result(size, size);
+  for (size_t k = 0; k < size; ++k) {
+    for (size_t i = 0; i < size; ++i) {
+      result.set(i, k, vectors[k * size + i]);
+    }
+  }
+  return result;
+}
+std::vector<int> vectors(const cluster::IntMatrix& columns, size_t size) {
+  if (columns.num_rows() != static_cast<int>(size) ||
+      columns.num_cols() != static_cast<int>(size)) {
+    throw std::runtime_error(
+        "Seed vectors do not match the size of the quiver");
+  }
+  std::vector<int> result(size * size);
+  for (size_t k = 0; k < size; ++k) {
+    for (size_t i = 0; i < size; ++i) {
+      result[k * size + i] = columns.get(i, k);
+    }
+  }
+  return result;
+}
+}
+GVectorSeed::GVectorSeed(const cluster::QuiverMatrix& matrix, bool labelled,
+                         Vectors shown)
+    : size_(matrix.num_rows()),
+      initial_(std::make_shared<const cluster::IntMatrix>(matrix)),
+      matrix_(matrix),
+      c_(size_ * size_, 0),
+      g_(size_ * size_, 0),
+      labelled_(labelled),
+      shown_(shown) {
+  for (size_t k = 0; k < size_; ++k) {
+    c_[k * size_ + k] = 1;
+    g_[k * size_ + k] = 1;
+  }
+  compute_hash();
+}
+GVectorSeed::GVectorSeed(const GVectorSeed& initial,
+                         const cluster::QuiverMatrix& matrix,
+                         const cluster::IntMatrix& c_vectors,
+                         const cluster::IntMatrix& g_vectors)
+    : size_(initial.size_),
+      initial_(initial.initial_),
+      matrix_(matrix),
+      c_(vectors(c_vectors, size_)),
+      g_(vectors(g_vectors, size_)),
+      labelled_(initial.labelled_),
+      shown_(initial.shown_) {
+  if (matrix.num_rows() != static_cast<int>(size_) ||
+      matrix.num_cols() != static_cast<int>(size_)) {
+    throw std::runtime_error("Seed quiver does not match the initial seed");
+  }
+  compute_hash();
+}
+cluster::IntMatrix GVectorSeed::c_vectors() const {
+  return columns(c_, size_);
+}
+cluster::IntMatrix GVectorSeed::g_vectors() const {
+  return columns(g_, size_);
+}
+std::string GVectorSeed::label(size_t vertex) const {
+  const std::vector<int>& vecs = shown_ == Vectors::G ? g_ : c_;
+  std::ostringstream ss;
+  ss << '(';
+  for (size_t i = 0; i < size_; ++i) {
+    if (i != 0) {
+      ss << ',';
+    }
+    ss << vecs[vertex * size_ + i];
+  }
+  ss << ')';
+  return ss.str();
+}
+void GVectorSeed::mutate(int k, GVectorSeed& result) const {
+  const size_t n = size_;
+  const int* c_k = c_.data() + k * n;
+  const int* g_k = g_vector(k);
+  /* The c-vectors are the coefficient rows of the framed quiver, so change in
+   * the same way as the rows of the exchange matrix. */
+  for (size_t l = 0; l < n; ++l) {
+    int* c_l = result.c_.data() + l * n;
+    if (static_cast<int>(l) == k) {
+      for (size_t j = 0; j < n; ++j) {
+        c_l[j] = -c_k[j];
+      }
+    } else {
+      const int b_kl = matrix_.get(k, l);
+      for (size_t j = 0; j < n; ++j) {
+        c_l[j] = c_[l * n + j] + exchange(c_k[j], b_kl);
+      }
+    }
+  }
+  /* g'_k = -g_k + sum_l [b_lk]_+ g_l - sum_j [c_jk]_+ b0_j, where b0_j is the
+   * j-th column of the initial exchange matrix. */
+  int* result_k = result.g_.data() + k * n;
+  for (size_t i = 0; i < n; ++i) {
+    int entry = -g_k[i];
+    for (size_t l = 0; l < n; ++l) {
+      const int b_lk = positive(matrix_.get(l, k));
+      if (b_lk != 0) {
+        entry += b_lk * g_[l * n + i];
+      }
+      const int c_lk = positive(c_k[l]);
+      if (c_lk != 0) {
+        entry -= c_lk * initial_->get(i, l);
+      }
+    }
+    result_k[i] = entry;
+  }
+  matrix_.mutate(k, result.matrix_);
+  result.compute_hash();
+}
+bool GVectorSeed::equals(const GVectorSeed& other) const {
+  if (hash_ != other.hash_ || size_ != other.size_) {
+    return false;
+  }
+  if (labelled_) {
+    return g_ == other.g_;
+  }
+  /* The g-vectors of a seed are all different, so it is enough that each
+   * g-vector appears somewhere in the other seed. */
+  for (size_t k = 0; k < size_; ++k) {
+    const int* vec = g_vector(k);
+    bool found = false;
+    for (size_t l = 0; l < size_ && !found; ++l) {
+      found = std::equal(vec, vec + size_, other.g_vector(l));
+    }
+    if (!found) {
+      return false;
+    }
+  }
+  return true;
+}
+void GVectorSeed::compute_hash() {
+  size_t result = 0;
+  for (size_t k = 0; k < size_; ++k) {
+    const size_t vec = hash_vector(g_vector(k), size_);
+    /* The order of the vertices only matters for labelled seeds. */
+    result = labelled_ ? 31 * result + vec : result + vec;
+  }
+  hash_ = result;
+}
+std::ostream& operator<<(std::ostream& os, const GVectorSeed& seed) {
+  return os << seed.matrix_ << ' ' << seed.g_vectors();
+}
+}
@@ -0,0 +1,359 @@
+/*
+ * incremental.cc
+ * Copyright 2014-2015 John Lawson
+ *
+ * This program is free software: you can redistribute it and/or modify
+ * it under the terms of the GNU General Public License as published by
+ * the Free Software Foundation, either version 3 of the License, or
+ * (at your option) any later version.
+ *
+ * This program is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ * GNU General Public License for more details.
+ *
+ * You should have received a copy of the GNU General Public License
+ * along with this program.  If not, see <http://www.gnu.org/licenses/>.
+ */
+#include "incremental.h"
+
+#include <algorithm>
+#include <chrono>
+#include <cmath>
+#include <cstdint>
+#include <deque>
+#include <fstream>
+#include <sstream>
+#include <stdexcept>
+#include <unordered_map>
+
+#include "layout.h"
+#include "qvb.h"
+#include "trace.h"
+
+namespace qvlayout {
+namespace {
+/* Number of relaxation steps for the new nodes. */
+const int ITERATIONS = 50;
+/* Edge length used if no edge joins two known nodes, in node sizes. */
+const double DEFAULT_LENGTH = 5.0;
+/* Angle between successive nodes placed around the same point, so they do
+ * not start on top of each other. */
+const double GOLDEN_ANGLE = 2.39996322972865332;
+typedef std::pair<double, double> Point;
+bool is_qvb(const std::string& path) {
+  std::ifstream file(path, std::ios::binary);
+  char magic[4] = {};
+  file.read(magic, sizeof(magic));
+  return file && magic[0] == 'Q' && magic[1] == 'V' && magic[2] == 'B' &&
+         magic[3] == '\0';
+}
+PreviousLayout read_qvb(const std::string& path) {
+  qvdraw::qvb::MappedGraph mapped(path);
+  if (!mapped.has_coordinates()) {
+    throw std::runtime_error(path + " has not been laid out");
+  }
+  PreviousLayout result;
+  result.coords.reserve(mapped.size());
+  result.keys.reserve(mapped.size());
+  for (size_t i = 0; i < mapped.size(); ++i) {
+    result.coords.emplace_back(mapped.x(i), mapped.y(i));
+    std::ostringstream key;
+    if (mapped.has_matrix(i)) {
+      key << mapped.matrix(i);
+    }
+    result.keys.push_back(key.str());
+  }
+  return result;
+}
+PreviousLayout read_gml(const std::string& path) {
+  ogdf::Graph graph;
+  ogdf::GraphAttributes attr(graph, ogdf::GraphAttributes::nodeGraphics |
+                                        ogdf::GraphAttributes::edgeGraphics |
+                                        ogdf::GraphAttributes::nodeLabel);
+  if (!attr.readGML(graph, path.c_str())) {
+    throw std::runtime_error("Could not load " + path);
+  }
+  PreviousLayout result;
+  result.keys = label_keys(graph, attr);
+  ogdf::node n;
+  forall_nodes(n, graph) { result.coords.emplace_back(attr.x(n), attr.y(n)); }
+  return result;
+}
+/* Grid of points with cells the size of an edge, to find the points near to
+ * a position without looking at all of them. */
+class Grid {
+ public:
+  explicit Grid(double cell) : cell_(cell) {}
+  void add(const Point& p, int id) {
+    cells_[key(cell(p.first), cell(p.second))].push_back(id);
+  }
+  void clear() { cells_.clear(); }
+  /* Call f with every point in the cells around p. */
+  template <class F>
+  void near(const Point& p, F&& f) const {
+    const int64_t cx = cell(p.first);
+    const int64_t cy = cell(p.second);
+    for (int64_t x = cx - 1; x <= cx + 1; ++x) {
+      for (int64_t y = cy - 1; y <= cy + 1; ++y) {
+        auto found = cells_.find(key(x, y));
+        if (found != cells_.end()) {
+          for (int id : found->second) {
+            f(id);
+          }
+        }
+      }
+    }
+  }
+
+ private:
+  const double cell_;
+  std::unordered_map<uint64_t, std::vector<int>> cells_;
+  int64_t cell(double v) const {
+    return static_cast<int64_t>(std::floor(v / cell_));
+  }
+  static uint64_t key(int64_t x, int64_t y) {
+    return (static_cast<uint64_t>(x) << 32) ^
+           static_cast<uint64_t>(static_cast<uint32_t>(y));
+  }
+};
+double distance(const Point& a, const Point& b) {
+  return std::hypot(a.first - b.first, a.second - b.second);
+}
+}
+std::ostream& operator<<(std::ostream& os, const ExtendStats& stats) {
+  os << "Incremental layout: kept " << stats.known << " nodes, placed "
+     << stats.placed << " new nodes in " << stats.seconds << "s";
+  return os;
+}
+PreviousLayout read_previous(const std::string& path) {
+  return is_qvb(path) ? read_qvb(path) : read_gml(path);
+}
+std::vector<std::string> label_keys(const ogdf::Graph& graph,
+                                    const ogdf::GraphAttributes& attr) {
+  std::vector<std::string> keys;
+  keys.reserve(graph.numberOfNodes());
+  const bool labels =
+      (attr.attributes() & ogdf::GraphAttributes::nodeLabel) != 0;
+  ogdf::node n;
+  forall_nodes(n, graph) {
+    keys.push_back(labels ? attr.labelNode(n).cstr() : "");
+  }
+  return keys;
+}
+std::vector<bool> place_known(const PreviousLayout& previous,
+                              const std::vector<std::string>& keys,
+                              const ogdf::Graph& graph,
+                              ogdf::GraphAttributes& attr) {
+  auto keyed = [](const std::vector<std::string>& all) {
+    return !all.empty() &&
+           std::none_of(all.begin(), all.end(),
+                        [](const std::string& k) { return k.empty(); });
+  };
+  const size_t size = graph.numberOfNodes();
+  std::vector<bool> known(size, false);
+  /* Previous position of each node, or SIZE_MAX. */
+  std::vector<size_t> match(size, SIZE_MAX);
+  if (keyed(previous.keys) && keys.size() == size && keyed(keys)) {
+    std::unordered_map<std::string, std::deque<size_t>> by_key;
+    for (size_t i = 0; i < previous.keys.size(); ++i) {
+      by_key[previous.keys[i]].push_back(i);
+    }
+    for (size_t i = 0; i < size; ++i) {
+      auto found = by_key.find(keys[i]);
+      if (found != by_key.end() && !found->second.empty()) {
+        match[i] = found->second.front();
+        found->second.pop_front();
+      }
+    }
+  } else {
+    for (size_t i = 0; i < size && i < previous.coords.size(); ++i) {
+      match[i] = i;
+    }
+  }
+  size_t i = 0;
+  ogdf::node n;
+  forall_nodes(n, graph) {
+    if (match[i] != SIZE_MAX) {
+      attr.x(n) = previous.coords[match[i]].first;
+      attr.y(n) = previous.coords[match[i]].second;
+      known[i] = true;
+    }
+    ++i;
+  }
+  return known;
+}
+ExtendStats extend(ogdf::Graph& graph, ogdf::GraphAttributes& attr,
+                   const std::vector<bool>& known, int size, bool fixed) {
+  qvdraw::trace::Scope scope("extend");
+  typedef std::chrono::steady_clock Clock;
+  const Clock::time_point start = Clock::now();
+  ExtendStats stats{0, 0, 0};
+  std::vector<ogdf::node> nodes;
+  nodes.reserve(graph.numberOfNodes());
+  ogdf::NodeArray<int> index(graph, -1);
+  ogdf::node n;
+  forall_nodes(n, graph) {
+    index[n] = nodes.size();
+    nodes.push_back(n);
+    attr.width(n) = size;
+    attr.height(n) = size;
+  }
+  stats.known = std::count(known.begin(), known.end(), true);
+  stats.placed = nodes.size() - stats.known;
+  if (stats.known == 0) {
+    layout(graph, attr, size, Method::Energy);
+  } else if (stats.placed > 0) {
+    std::vector<std::vector<int>> adjacent(nodes.size());
+    ogdf::edge e;
+    forall_edges(e, graph) {
+      adjacent[index[e->source()]].push_back(index[e->target()]);
+      adjacent[index[e->target()]].push_back(index[e->source()]);
+    }
+    std::vector<Point> pos(nodes.size());
+    std::vector<bool> placed(known);
+    for (size_t i = 0; i < nodes.size(); ++i) {
+      pos[i] = Point(attr.x(nodes[i]), attr.y(nodes[i]));
+    }
+    /* Ideal edge length taken from the known part of the layout. */
+    std::vector<double> lengths;
+    for (size_t i = 0; i < nodes.size(); ++i) {
+      for (int j : adjacent[i]) {
+        if (known[i] && known[j] && static_cast<int>(i) < j) {
+          lengths.push_back(distance(pos[i], pos[j]));
+        }
+      }
+    }
+    double length = DEFAULT_LENGTH * size;
+    if (!lengths.empty()) {
+      std::nth_element(lengths.begin(), lengths.begin() + lengths.size() / 2,
+                       lengths.end());
+      length = std::max(lengths[lengths.size() / 2], 1.0);
+    }
+    /* Breadth first from the known nodes, starting each new node at the
+     * centre of its placed neighbours. A part of the graph with no known
+     * nodes is started to the right of everything placed so far. */
+    std::vector<int> fresh;
+    std::deque<int> queue;
+    for (size_t i = 0; i < nodes.size(); ++i) {
+      if (known[i]) {
+        queue.push_back(i);
+      }
+    }
+    double right = 0;
+    for (size_t i = 0; i < nodes.size(); ++i) {
+      if (known[i]) {
+        right = std::max(right, pos[i].first);
+      }
+    }
+    size_t next_unplaced = 0;
+    while (true) {
+      while (!queue.empty()) {
+        const int v = queue.front();
+        queue.pop_front();
+        for (int w : adjacent[v]) {
+          if (placed[w]) {
+            continue;
+          }
+          double x = 0;
+          double y = 0;
+          int count = 0;
+          for (int u : adjacent[w]) {
+            if (placed[u]) {
+              x += pos[u].first;
+              y += pos[u].second;
+              ++count;
+            }
+          }
+          const double angle = GOLDEN_ANGLE * fresh.size();
+          pos[w] = Point(x / count + 0.5 * length * std::cos(angle),
+                         y / count + 0.5 * length * std::sin(angle));
+          right = std::max(right, pos[w].first);
+          placed[w] = true;
+          fresh.push_back(w);
+          queue.push_back(w);
+        }
+      }
+      while (next_unplaced < nodes.size() && placed[next_unplaced]) {
+        ++next_unplaced;
+      }
+      if (next_unplaced == nodes.size()) {
+        break;
+      }
+      right += 2 * length;
+      pos[next_unplaced] = Point(right, 0);
+      placed[next_unplaced] = true;
+      fresh.push_back(next_unplaced);
+      queue.push_back(next_unplaced);
+    }
+    /* Known nodes never move, so are only put in the grid once. Only the
+     * known nodes near a new node are ever looked at. */
+    Grid fixed_grid(2 * length);
+    for (size_t i = 0; i < nodes.size(); ++i) {
+      if (known[i]) {
+        fixed_grid.add(pos[i], i);
+      }
+    }
+    Grid moving(2 * length);
+    std::vector<Point> moves(fresh.size());
+    qvdraw::trace::count(qvdraw::trace::Layouts);
+    qvdraw::trace::count(qvdraw::trace::RefineIterations, ITERATIONS);
+    for (int it = 0; it < ITERATIONS; ++it) {
+      const double temperature = length * (1.0 - it / double(ITERATIONS));
+      moving.clear();
+      for (int v : fresh) {
+        moving.add(pos[v], v);
+      }
+      for (size_t k = 0; k < fresh.size(); ++k) {
+        const int v = fresh[k];
+        double dx = 0;
+        double dy = 0;
+        auto repel = [&](int u) {
+          if (u == v) {
+            return;
+          }
+          double ex = pos[v].first - pos[u].first;
+          double ey = pos[v].second - pos[u].second;
+          double d2 = ex * ex + ey * ey;
+          if (d2 < 1e-9) {
+            /* Push coincident nodes apart in a direction fixed by their
+             * numbers. */
+            ex = std::cos(v - u);
+            ey = std::sin(v - u);
+            d2 = 1;
+          }
+          dx += ex * length * length / d2;
+          dy += ey * length * length / d2;
+        };
+        fixed_grid.near(pos[v], repel);
+        moving.near(pos[v], repel);
+        for (int u : adjacent[v]) {
+          const double d = distance(pos[v], pos[u]);
+          dx += (pos[u].first - pos[v].first) * d / length;
+          dy += (pos[u].second - pos[v].second) * d / length;
+        }
+        const double d = std::hypot(dx, dy);
+        if (d > temperature) {
+          dx *= temperature / d;
+          dy *= temperature / d;
+        }
+        moves[k] = Point(dx, dy);
+      }
+      for (size_t k = 0; k < fresh.size(); ++k) {
+        pos[fresh[k]].first += moves[k].first;
+        pos[fresh[k]].second += moves[k].second;
+      }
+    }
+    for (int v : fresh) {
+      attr.x(nodes[v]) = pos[v].first;
+      attr.y(nodes[v]) = pos[v].second;
+    }
+  }
+  if (!fixed && stats.known > 0) {
+    relax(graph, attr, size);
+  }
+  stats.seconds =
+      std::chrono::duration<double>(Clock::now() - start).count();
+  return stats;
+}
+}
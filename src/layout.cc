@@ -20,6 +20,12 @@
  */
 #include "layout.h"
 
+#include <algorithm>
+#include <chrono>
+#include <cmath>
+#include <utility>
+#include <vector>
+
 #include <ogdf/energybased/FMMMLayout.h>
 
 #include <ogdf/layered/SugiyamaLayout.h>
@@ -34,6 +40,8 @@
 #include <ogdf/upward/SubgraphUpwardPlanarizer.h>
 #include <ogdf/upward/UpwardPlanarizationLayout.h>
 #include <ogdf/upward/VisibilityLayout.h>
+
+#include "trace.h"
  
 namespace qvlayout {
 namespace {
@@ -43,12 +51,126 @@ typedef ogdf::FMMMLayout FL;
 typedef ogdf::UpwardPlanarizationLayout UPL;
 }
 
-void layout(Graph & graph, GraphA & attr, int size, Method method) {
+namespace {
+const int RELAX_ITERATIONS = 10;
+/*
+ * layout_auto uses the best quality for graphs with at most SMALL_GRAPH nodes
+ * and edges together, the middle quality up to LARGE_GRAPH and the fastest
+ * above that.
+ */
+const int SMALL_GRAPH = 200;
+const int LARGE_GRAPH = 5000;
+/* Iterations in each refinement pass of layout_auto. */
+const int REFINE_ITERATIONS = 30;
+/* Refinement stops once no node moves further than this fraction of the node
+ * size in a pass, as the layout has settled. */
+const double SETTLED = 0.1;
+void set_size(Graph & graph, GraphA & attr, int size) {
 	ogdf::node v;
 	forall_nodes(v, graph) {
 		attr.width(v) = size;
 		attr.height(v) = size;
 	}
+}
+/* Run a few iterations of FMMM from the current positions. */
+void refine(GraphA & attr, int iterations) {
+	qvdraw::trace::count(qvdraw::trace::RefineIterations, iterations);
+	FL l;
+	l.useHighLevelOptions(false);
+	l.initialPlacementForces(l.ipfKeepPositions);
+	l.fixedIterations(iterations);
+	l.fineTuningIterations(iterations);
+	l.call(attr);
+}
+/* Largest distance any node has moved from the positions saved in before. */
+double largest_move(const Graph & graph, const GraphA & attr,
+		const std::vector<std::pair<double, double>> & before) {
+	double result = 0;
+	size_t i = 0;
+	ogdf::node v;
+	forall_nodes(v, graph) {
+		const double dx = attr.x(v) - before[i].first;
+		const double dy = attr.y(v) - before[i].second;
+		result = std::max(result, std::sqrt(dx * dx + dy * dy));
+		++i;
+	}
+	return result;
+}
+}
+
+std::ostream& operator<<(std::ostream& os, const AutoSettings& settings) {
+	os << "Layout: " << settings.nodes << " nodes, " << settings.edges
+		<< " edges, FMMM " << settings.quality << ", " << settings.refinements
+		<< " refinements, " << settings.seconds << "s";
+	return os;
+}
+
+void relax(Graph & graph, GraphA & attr, int size) {
+	qvdraw::trace::Scope scope("relax");
+	qvdraw::trace::count(qvdraw::trace::Layouts);
+	set_size(graph, attr, size);
+	refine(attr, RELAX_ITERATIONS);
+}
+
+AutoSettings layout_auto(Graph & graph, GraphA & attr, int size,
+		double budget) {
+	qvdraw::trace::Scope scope("layout auto");
+	qvdraw::trace::count(qvdraw::trace::Layouts);
+	typedef std::chrono::steady_clock Clock;
+	const Clock::time_point start = Clock::now();
+	auto elapsed = [&start]() {
+		return std::chrono::duration<double>(Clock::now() - start).count();
+	};
+	set_size(graph, attr, size);
+	AutoSettings settings;
+	settings.nodes = graph.numberOfNodes();
+	settings.edges = graph.numberOfEdges();
+	settings.refinements = 0;
+	const int work = settings.nodes + settings.edges;
+	FL l;
+	l.useHighLevelOptions(true);
+	if(work <= SMALL_GRAPH) {
+		/* As in Method::Energy. */
+		l.qualityVersusSpeed(l.qvsGorgeousAndEfficient);
+		l.newInitialPlacement(true);
+		settings.quality = "gorgeous and efficient";
+	} else if(work <= LARGE_GRAPH) {
+		l.qualityVersusSpeed(l.qvsBeautifulAndFast);
+		settings.quality = "beautiful and fast";
+	} else {
+		l.qualityVersusSpeed(l.qvsNiceAndIncredibleSpeed);
+		settings.quality = "nice and incredible speed";
+	}
+	l.call(attr);
+	/* A refinement is cheaper than the first pass, so the time of the last
+	 * pass is a safe estimate of the next. */
+	double last = elapsed();
+	std::vector<std::pair<double, double>> before;
+	while(budget > 0 && elapsed() + last <= budget) {
+		before.clear();
+		ogdf::node v;
+		forall_nodes(v, graph) {
+			before.emplace_back(attr.x(v), attr.y(v));
+		}
+		const double pass_start = elapsed();
+		refine(attr, REFINE_ITERATIONS);
+		++settings.refinements;
+		last = elapsed() - pass_start;
+		if(largest_move(graph, attr, before) < SETTLED * size) {
+			break;
+		}
+	}
+	settings.seconds = elapsed();
+	return settings;
+}
+
+void layout(Graph & graph, GraphA & attr, int size, Method method) {
+	qvdraw::trace::Scope scope("layout");
+	if(method != Method::Auto) {
+		/* layout_auto counts itself. */
+		qvdraw::trace::count(qvdraw::trace::Layouts);
+	}
+	set_size(graph, attr, size);
 	switch(method) {
 		case Method::Energy:
 			{
@@ -99,6 +221,9 @@ void layout(Graph & graph, GraphA & attr, int size, Method method) {
 			layout.call(attr);
 			break;
 			}
+		case Method::Auto:
+			layout_auto(graph, attr, size);
+			break;
 	}
 }
 }
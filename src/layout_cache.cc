@@ -0,0 +1,400 @@
+/*
+ * layout_cache.cc
+ * Copyright 2014-2015 John Lawson
+ *
+ * This program is free software: you can redistribute it and/or modify
+ * it under the terms of the GNU General Public License as published by
+ * the Free Software Foundation, either version 3 of the License, or
+ * (at your option) any later version.
+ *
+ * This program is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ * GNU General Public License for more details.
+ *
+ * You should have received a copy of the GNU General Public License
+ * along with this program.  If not, see <http://www.gnu.org/licenses/>.
+ */
+/**
+ * Each cache file holds every entry with the same key:
+ *
+ *   qvlayout 1
+ *   { { 0 1 } { -1 0 } }
+ *   2
+ *   0 0
+ *   15 0
+ *
+ * with a matrix line, the number of vertices and then a line of coordinates
+ * for each vertex, repeated for each entry.
+ */
+#include "layout_cache.h"
+
+#include <dirent.h>
+#include <fcntl.h>
+#include <sys/file.h>
+#include <sys/stat.h>
+#include <unistd.h>
+#include <utime.h>
+
+#include <algorithm>
+#include <cstdio>
+#include <fstream>
+#include <functional>
+#include <limits>
+#include <sstream>
+#include <thread>
+
+#include "dynkin_layout.h"
+#include "trace.h"
+
+namespace qvlayout {
+namespace {
+const char* const MAGIC = "qvlayout 1";
+const std::string EXTENSION = ".qvl";
+/* Held while a cache file is read, added to and written back. */
+const std::string LOCK_FILE = "lock";
+struct CacheFile {
+  std::string path;
+  time_t mtime;
+  size_t size;
+};
+bool ends_with(const std::string& str, const std::string& end) {
+  return str.size() >= end.size() &&
+         str.compare(str.size() - end.size(), end.size(), end) == 0;
+}
+void make_directories(const std::string& directory) {
+  for (size_t pos = directory.find('/', 1); pos != std::string::npos;
+       pos = directory.find('/', pos + 1)) {
+    mkdir(directory.substr(0, pos).c_str(), 0755);
+  }
+  mkdir(directory.c_str(), 0755);
+}
+std::vector<CacheFile> list_files(const std::string& directory) {
+  std::vector<CacheFile> result;
+  DIR* dir = opendir(directory.c_str());
+  if (dir == nullptr) {
+    return result;
+  }
+  while (dirent* ent = readdir(dir)) {
+    std::string name = ent->d_name;
+    if (!ends_with(name, EXTENSION)) {
+      continue;
+    }
+    std::string path = directory + "/" + name;
+    struct stat st;
+    if (stat(path.c_str(), &st) == 0) {
+      result.push_back({path, st.st_mtime, static_cast<size_t>(st.st_size)});
+    }
+  }
+  closedir(dir);
+  return result;
+}
+/* Unique name for a temporary file, so that concurrent writers of the same
+ * entry from different processes or threads never share a file. */
+std::string temp_path(const std::string& path) {
+  size_t thread = std::hash<std::thread::id>()(std::this_thread::get_id());
+  return path + "." + std::to_string(getpid()) + "." +
+         std::to_string(thread) + ".tmp";
+}
+/*
+ * Exclusive lock on a file, held until destruction. Each lock opens the file
+ * afresh, so it excludes other threads of the same process as well as other
+ * processes. If the file cannot be opened or locked then nothing is held, and
+ * the cache files must be left alone.
+ */
+class FileLock {
+ public:
+  explicit FileLock(const std::string& path)
+      : fd_(open(path.c_str(), O_RDWR | O_CREAT, 0644)) {
+    if (fd_ != -1 && flock(fd_, LOCK_EX) != 0) {
+      close(fd_);
+      fd_ = -1;
+    }
+  }
+  bool held() const { return fd_ != -1; }
+  ~FileLock() {
+    if (fd_ != -1) {
+      flock(fd_, LOCK_UN);
+      close(fd_);
+    }
+  }
+  FileLock(const FileLock&) = delete;
+  FileLock& operator=(const FileLock&) = delete;
+
+ private:
+  int fd_;
+};
+}  // anonymous namespace
+LayoutCache::LayoutCache() : LayoutCache(std::string(), 0) {}
+LayoutCache::LayoutCache(const std::string& directory, size_t max_bytes)
+    : directory_(directory),
+      max_bytes_(max_bytes),
+      hits_(0),
+      misses_(0),
+      writes_(0),
+      evictions_(0),
+      disk_bytes_(0) {
+  if (!directory_.empty()) {
+    make_directories(directory_);
+    size_t total = 0;
+    for (const CacheFile& file : list_files(directory_)) {
+      total += file.size;
+    }
+    disk_bytes_ = total;
+  }
+}
+std::string LayoutCache::key(const cluster::EquivQuiverMatrix& matrix,
+                             Method method, int size) const {
+  std::ostringstream ss;
+  ss << std::hex << matrix.hash() << std::dec << "-" << static_cast<int>(method)
+     << "-" << size;
+  return ss.str();
+}
+std::string LayoutCache::path(const std::string& key) const {
+  return directory_ + "/" + key + EXTENSION;
+}
+/*
+ * Must be called while holding the mutex.
+ *
+ * get_permutation gives perm such that vertex i of the cached matrix is vertex
+ * perm[i] of the matrix being looked up.
+ */
+const LayoutCache::Entry* LayoutCache::find_in(
+    const Bucket& bucket, const cluster::EquivQuiverMatrix& matrix,
+    Coords& coords) {
+  const size_t n = matrix.num_rows();
+  for (const Entry& entry : bucket) {
+    if (entry.coords.size() != n ||
+        static_cast<size_t>(entry.matrix.num_rows()) != n ||
+        !entry.matrix.equals(matrix)) {
+      continue;
+    }
+    std::vector<int> perm = entry.matrix.get_permutation(matrix);
+    if (perm.size() != n) {
+      continue;
+    }
+    coords.assign(n, std::make_pair(0.0, 0.0));
+    for (size_t i = 0; i < n; ++i) {
+      coords[perm[i]] = entry.coords[i];
+    }
+    return &entry;
+  }
+  return nullptr;
+}
+std::vector<LayoutCache::Record> LayoutCache::load(
+    const std::string& key) const {
+  std::vector<Record> records;
+  std::ifstream file(path(key));
+  std::string line;
+  if (!std::getline(file, line) || line != MAGIC) {
+    return records;
+  }
+  while (std::getline(file, line) && !line.empty()) {
+    size_t n;
+    if (!(file >> n)) {
+      break;
+    }
+    Coords coords(n);
+    for (size_t i = 0; i < n; ++i) {
+      file >> coords[i].first >> coords[i].second;
+    }
+    file.ignore(std::numeric_limits<std::streamsize>::max(), '\n');
+    if (!file) {
+      break;
+    }
+    records.push_back({cluster::IntMatrix(line), std::move(coords)});
+  }
+  return records;
+}
+/*
+ * Must be called while holding the file lock but not the mutex. Returns
+ * whether the files now take up more than the limit.
+ */
+bool LayoutCache::save(const std::string& key,
+                       const std::vector<Record>& records) {
+  std::ostringstream ss;
+  ss.precision(17);
+  ss << MAGIC << '\n';
+  for (const Record& record : records) {
+    ss << record.matrix << '\n' << record.coords.size() << '\n';
+    for (const auto& xy : record.coords) {
+      ss << xy.first << " " << xy.second << '\n';
+    }
+  }
+  const std::string contents = ss.str();
+  const std::string final_path = path(key);
+  const std::string temp = temp_path(final_path);
+  struct stat st;
+  const size_t old_size =
+      stat(final_path.c_str(), &st) == 0 ? static_cast<size_t>(st.st_size) : 0;
+  {
+    std::ofstream file(temp);
+    file << contents;
+    if (!file) {
+      std::remove(temp.c_str());
+      return false;
+    }
+  }
+  if (std::rename(temp.c_str(), final_path.c_str()) != 0) {
+    std::remove(temp.c_str());
+    return false;
+  }
+  std::lock_guard<std::mutex> lock(mutex_);
+  ++writes_;
+  /* The file replaces the old one, so only the difference is added. */
+  disk_bytes_ += contents.size();
+  disk_bytes_ -= std::min(old_size, disk_bytes_);
+  return disk_bytes_ > max_bytes_;
+}
+/* Remove the least recently used files until the cache is back under three
+ * quarters of its limit, so that eviction does not happen on every write.
+ * Must be called without holding the file lock or the mutex. */
+void LayoutCache::evict() {
+  FileLock file_lock(directory_ + "/" + LOCK_FILE);
+  if (!file_lock.held()) {
+    return;
+  }
+  std::vector<CacheFile> files = list_files(directory_);
+  size_t total = 0;
+  for (const CacheFile& file : files) {
+    total += file.size;
+  }
+  std::sort(files.begin(), files.end(),
+            [](const CacheFile& a, const CacheFile& b) {
+              return a.mtime < b.mtime;
+            });
+  const size_t target = max_bytes_ / 4 * 3;
+  size_t removed = 0;
+  for (auto it = files.begin(); it != files.end() && total > target; ++it) {
+    if (std::remove(it->path.c_str()) == 0) {
+      total -= it->size;
+      ++removed;
+    }
+  }
+  std::lock_guard<std::mutex> lock(mutex_);
+  evictions_ += removed;
+  disk_bytes_ = total;
+}
+bool LayoutCache::find(const cluster::IntMatrix& matrix, Method method,
+                       int size, Coords& coords) {
+  std::unique_lock<std::mutex> lock(mutex_);
+  cluster::EquivQuiverMatrix equiv(matrix);
+  const std::string k = key(equiv, method, size);
+  auto it = memory_.find(k);
+  if (it != memory_.end() && find_in(it->second, equiv, coords) != nullptr) {
+    ++hits_;
+    return true;
+  }
+  if (!directory_.empty()) {
+    lock.unlock();
+    std::vector<Record> records = load(k);
+    lock.lock();
+    for (Record& record : records) {
+      Bucket single{{cluster::EquivQuiverMatrix(record.matrix),
+                     std::move(record.coords)}};
+      if (find_in(single, equiv, coords) != nullptr) {
+        memory_[k].push_back(std::move(single.front()));
+        /* Mark the file as recently used. */
+        utime(path(k).c_str(), nullptr);
+        ++hits_;
+        return true;
+      }
+    }
+  }
+  ++misses_;
+  return false;
+}
+void LayoutCache::insert(const cluster::IntMatrix& matrix, Method method,
+                         int size, const Coords& coords) {
+  std::unique_lock<std::mutex> lock(mutex_);
+  cluster::EquivQuiverMatrix equiv(matrix);
+  const std::string k = key(equiv, method, size);
+  Coords existing;
+  Bucket& bucket = memory_[k];
+  if (find_in(bucket, equiv, existing) == nullptr) {
+    bucket.push_back({equiv, coords});
+  }
+  if (!directory_.empty()) {
+    lock.unlock();
+    bool full;
+    {
+      /* Without the file lock two processes adding to the same file would
+       * each write back what they read, losing the other's entry. */
+      FileLock file_lock(directory_ + "/" + LOCK_FILE);
+      if (!file_lock.held()) {
+        return;
+      }
+      std::vector<Record> records = load(k);
+      lock.lock();
+      for (const Record& record : records) {
+        cluster::EquivQuiverMatrix stored(record.matrix);
+        if (stored.num_rows() == equiv.num_rows() && stored.equals(equiv)) {
+          return;
+        }
+      }
+      lock.unlock();
+      records.push_back({matrix, coords});
+      full = save(k, records);
+    }
+    if (full) {
+      evict();
+    }
+  }
+}
+LayoutCache::Stats LayoutCache::stats() const {
+  return {hits_, misses_, writes_, evictions_};
+}
+void LayoutCache::report(std::ostream& os) const {
+  Stats s = stats();
+  os << "Layout cache: " << s.hits << " hits, " << s.misses << " misses, "
+     << s.writes << " writes, " << s.evictions << " evictions"
+     << os.widen('\n');
+}
+void layout(const cluster::IntMatrix& matrix, ogdf::Graph& graph,
+            ogdf::GraphAttributes& attr, int size, Method method,
+            LayoutCache* cache, const LayoutCache::Coords* initial) {
+  qvdraw::trace::Scope scope("layout quiver");
+  std::vector<ogdf::node> nodes;
+  nodes.reserve(graph.numberOfNodes());
+  ogdf::node n;
+  forall_nodes(n, graph) { nodes.push_back(n); }
+  /* A warm started layout depends on where it started from, so is neither
+   * replaced by nor stored as the layout of the quiver itself. */
+  if (initial != nullptr && initial->size() == nodes.size()) {
+    for (size_t i = 0; i < nodes.size(); ++i) {
+      attr.x(nodes[i]) = (*initial)[i].first;
+      attr.y(nodes[i]) = (*initial)[i].second;
+    }
+    relax(graph, attr, size);
+    return;
+  }
+  const bool use_cache = cache != nullptr &&
+                         graph.numberOfNodes() <= LayoutCache::MAX_NODES &&
+                         graph.numberOfNodes() == matrix.num_rows();
+
+  LayoutCache::Coords coords;
+  /* Dynkin and affine quivers have a fixed drawing, which is quicker to work
+   * out than to look up. */
+  const bool force_directed =
+      method == Method::Energy || method == Method::Auto;
+  if ((force_directed && graph.numberOfNodes() == matrix.num_rows() &&
+       dynkin_layout(matrix, size, coords)) ||
+      (use_cache && cache->find(matrix, method, size, coords))) {
+    for (size_t i = 0; i < nodes.size(); ++i) {
+      attr.x(nodes[i]) = coords[i].first;
+      attr.y(nodes[i]) = coords[i].second;
+      attr.width(nodes[i]) = size;
+      attr.height(nodes[i]) = size;
+    }
+    return;
+  }
+  layout(graph, attr, size, method);
+  if (use_cache) {
+    coords.resize(nodes.size());
+    for (size_t i = 0; i < nodes.size(); ++i) {
+      coords[i] = std::make_pair(attr.x(nodes[i]), attr.y(nodes[i]));
+    }
+    cache->insert(matrix, method, size, coords);
+  }
+}
+}
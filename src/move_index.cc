@@ -0,0 +1,83 @@
+/*
+ * move_index.cc
+ * Copyright 2014-2015 John Lawson
+ *
+ * This program is free software: you can redistribute it and/or modify
+ * it under the terms of the GNU General Public License as published by
+ * the Free Software Foundation, either version 3 of the License, or
+ * (at your option) any later version.
+ *
+ * This program is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ * GNU General Public License for more details.
+ *
+ * You should have received a copy of the GNU General Public License
+ * along with this program.  If not, see <http://www.gnu.org/licenses/>.
+ */
+#include "move_index.h"
+
+#include <algorithm>
+#include <cstdlib>
+#include <functional>
+#include <tuple>
+
+#include "trace.h"
+
+namespace qvdraw {
+MoveIndex::Signature::Signature(const cluster::IntMatrix& matrix)
+    : size(matrix.num_rows()), degrees(matrix.num_rows(), 0) {
+  for (int i = 0; i < size; ++i) {
+    for (int j = i + 1; j < size; ++j) {
+      const int weight = std::abs(matrix.get(i, j) * matrix.get(j, i));
+      if (weight != 0) {
+        weights.push_back(weight);
+        ++degrees[i];
+        ++degrees[j];
+      }
+    }
+  }
+  std::sort(weights.begin(), weights.end());
+  std::sort(degrees.begin(), degrees.end(), std::greater<int>());
+}
+bool MoveIndex::Signature::fits_in(const Signature& larger) const {
+  if (size > larger.size || weights.size() > larger.weights.size()) {
+    return false;
+  }
+  for (int i = 0; i < size; ++i) {
+    if (degrees[i] > larger.degrees[i]) {
+      return false;
+    }
+  }
+  return std::includes(larger.weights.begin(), larger.weights.end(),
+                       weights.begin(), weights.end());
+}
+bool MoveIndex::Signature::operator<(const Signature& other) const {
+  return std::tie(size, weights, degrees) <
+         std::tie(other.size, other.weights, other.degrees);
+}
+MoveIndex::MoveIndex(const std::vector<consts::MovePatterns>& patterns) {
+  moves_.reserve(patterns.size());
+  for (const consts::MovePatterns& move : patterns) {
+    moves_.emplace_back(Signature(move.a), Signature(move.b));
+  }
+}
+const std::vector<size_t>& MoveIndex::candidates(
+    const cluster::IntMatrix& quiver) const {
+  Signature signature(quiver);
+  auto found = memo_.find(signature);
+  if (found == memo_.end()) {
+    std::vector<size_t> result;
+    for (size_t i = 0; i < moves_.size(); ++i) {
+      if (moves_[i].first.fits_in(signature) ||
+          moves_[i].second.fits_in(signature)) {
+        result.push_back(i);
+      }
+    }
+    found = memo_.emplace(std::move(signature), std::move(result)).first;
+  }
+  trace::count(trace::MoveChecks, moves_.size());
+  trace::count(trace::MovesPruned, moves_.size() - found->second.size());
+  return found->second;
+}
+}
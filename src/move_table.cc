@@ -0,0 +1,551 @@
+/* Generated by qvmovegen from moves.txt. Do not edit, run make moves instead. */
+#include "move_table.h"
+
+namespace qvdraw {
+namespace consts {
+namespace {
+/* Line 10 */
+constexpr int a0[] = {0, 1, 0, -1, 0, 1, 0, -1, 0};
+constexpr int b0[] = {0, -1, 1, 1, 0, -1, -1, 1, 0};
+constexpr int conn0[] = {0, 2};
+constexpr Req reqs0[] = {Req::Unconnected, Req::Line};
+constexpr int args0[] = {0, 0};
+/* Line 16 */
+constexpr int a1[] = {0, -1, 0, 1, 0, -1, 0, 1, 0};
+constexpr int b1[] = {0, 1, -1, -1, 0, 1, 1, -1, 0};
+constexpr int conn1[] = {0, 2};
+constexpr Req reqs1[] = {Req::Unconnected, Req::Line};
+constexpr int args1[] = {0, 0};
+/* Line 22 */
+constexpr int a2[] = {0, 1, 0, 0, -1, 0, 1, 1, 0, -1, 0, 0, 0, -1, 0, 0};
+constexpr int b2[] = {0, -1, 1, 1, 1, 0, -1, -1, -1, 1, 0, 0, -1, 1, 0, 0};
+constexpr int conn2[] = {0, 2, 3};
+constexpr Req reqs2[] = {Req::Line, Req::ConnectedTo, Req::ConnectedTo};
+constexpr int args2[] = {0, 3, 2};
+/* Line 29 */
+constexpr int a3[] = {0, -1, 0, 0, 1, 0, -1, -1, 0, 1, 0, 0, 0, 1, 0, 0};
+constexpr int b3[] = {0, 1, -1, -1, -1, 0, 1, 1, 1, -1, 0, 0, 1, -1, 0, 0};
+constexpr int conn3[] = {0, 2, 3};
+constexpr Req reqs3[] = {Req::Line, Req::ConnectedTo, Req::ConnectedTo};
+constexpr int args3[] = {0, 3, 2};
+/* Line 36 */
+constexpr int a4[] = {0, 0, -1, 0, 0, 0, 0, -1, 0, 0, 1, 1, 0, 1, -1, 0, 0, -1, 0, 2, 0, 0, 1, -2, 0};
+constexpr int b4[] = {0, -1, 0, 0, 1, 1, 0, -1, 1, -1, 0, 1, 0, 0, 1, 0, -1, 0, 0, 1, -1, 1, -1, -1, 0};
+constexpr int conn4[] = {0};
+constexpr Req reqs4[] = {Req::Unconnected};
+constexpr int args4[] = {0};
+/* Line 41 */
+constexpr int a5[] = {0, 1, 0, 0, 0, -1, 0, -1, -1, 1, 0, 1, 0, 0, 0, 0, 1, 0, 0, 0, 0, -1, 0, 0, 0};
+constexpr int b5[] = {0, -1, 0, 0, 1, 1, 0, 1, 1, -1, 0, -1, 0, 0, 1, 0, -1, 0, 0, 1, -1, 1, -1, -1, 0};
+constexpr int conn5[] = {0, 4};
+constexpr Req reqs5[] = {Req::Unconnected, Req::Line};
+constexpr int args5[] = {0, 0};
+/* Line 47 */
+constexpr int a6[] = {0, -1, 0, 0, 0, 1, 0, 1, 1, -1, 0, -1, 0, 0, 0, 0, -1, 0, 0, 0, 0, 1, 0, 0, 0};
+constexpr int b6[] = {0, 1, 0, 0, -1, -1, 0, -1, -1, 1, 0, 1, 0, 0, -1, 0, 1, 0, 0, -1, 1, -1, 1, 1, 0};
+constexpr int conn6[] = {0, 4};
+constexpr Req reqs6[] = {Req::Unconnected, Req::Line};
+constexpr int args6[] = {0, 0};
+/* Line 54 */
+constexpr int a7[] = {0, -1, -1, -1, -1, 1, 1, 0, 0, 0, 0, 0, 1, 0, 0, 0, 0, 0, 1, 0, 0, 0, 0, 0, 1, 0, 0, 0, 0, 0, -1, 0, 0, 0, 0, 0};
+constexpr int b7[] = {0, 1, 1, 1, 1, -1, -1, 0, 0, 0, 0, 1, -1, 0, 0, 0, 0, 1, -1, 0, 0, 0, 0, 1, -1, 0, 0, 0, 0, 1, 1, -1, -1, -1, -1, 0};
+/* Line 58 */
+constexpr int a8[] = {0, -1, -1, -1, 1, -1, 1, 0, 0, 0, 0, 0, 1, 0, 0, 0, 0, 0, 1, 0, 0, 0, 0, 0, -1, 0, 0, 0, 0, 2, 1, 0, 0, 0, -2, 0};
+constexpr int b8[] = {0, 1, 1, 1, -1, 1, -1, 0, 0, 0, 1, 0, -1, 0, 0, 0, 1, 0, -1, 0, 0, 0, 1, 0, 1, -1, -1, -1, 0, 1, -1, 0, 0, 0, -1, 0};
+/* Line 63 */
+constexpr int a9[] = {0, 1, 0, -1, -1, 0, 1, 1, 0, -1, 0, -1, 1, -1, 1, 0};
+constexpr int b9[] = {0, 1, 0, 0, -1, 0, -1, 1, 0, 1, 0, -2, 0, -1, 2, 0};
+constexpr int conn9[] = {0};
+constexpr Req reqs9[] = {Req::Unconnected};
+constexpr int args9[] = {0};
+/* Line 68 */
+constexpr int a10[] = {0, -1, 0, 1, 1, 0, -1, -1, 0, 1, 0, 1, -1, 1, -1, 0};
+constexpr int b10[] = {0, -1, 0, 0, 1, 0, 1, -1, 0, -1, 0, 2, 0, 1, -2, 0};
+constexpr int conn10[] = {0};
+constexpr Req reqs10[] = {Req::Unconnected};
+constexpr int args10[] = {0};
+/* Line 73 */
+constexpr int a11[] = {0, 1, 0, 0, -1, 0, 1, -1, 0, -1, 0, 1, 0, 1, -1, 0};
+constexpr int b11[] = {0, -1, 1, 0, 1, 0, -1, 1, -1, 1, 0, 0, 0, -1, 0, 0};
+constexpr int conn11[] = {0, 2, 3};
+constexpr Req reqs11[] = {Req::Unconnected, Req::LineTo, Req::LineTo};
+constexpr int args11[] = {0, 3, 2};
+/* Line 80 */
+constexpr int a12[] = {0, -1, 0, 0, 1, 0, -1, 1, 0, 1, 0, -1, 0, -1, 1, 0};
+constexpr int b12[] = {0, 1, -1, 0, -1, 0, 1, -1, 1, -1, 0, 0, 0, 1, 0, 0};
+constexpr int conn12[] = {0, 2, 3};
+constexpr Req reqs12[] = {Req::Unconnected, Req::LineTo, Req::LineTo};
+constexpr int args12[] = {0, 3, 2};
+/* Line 87 */
+constexpr int a13[] = {0, 1, 0, 0, 0, -1, 0, -1, 1, -1, 0, 1, 0, 0, 0, 0, -1, 0, 0, 1, 0, 1, 0, -1, 0};
+constexpr int b13[] = {0, -1, 0, 1, 0, 1, 0, 1, -1, 1, 0, -1, 0, 1, 0, -1, 1, -1, 0, 0, 0, -1, 0, 0, 0};
+constexpr int conn13[] = {0, 3, 4};
+constexpr Req reqs13[] = {Req::Unconnected, Req::LineTo, Req::LineTo};
+constexpr int args13[] = {0, 4, 3};
+/* Line 94 */
+constexpr int a14[] = {0, -1, 0, 0, 0, 1, 0, 1, -1, 1, 0, -1, 0, 0, 0, 0, 1, 0, 0, -1, 0, -1, 0, 1, 0};
+constexpr int b14[] = {0, 1, 0, -1, 0, -1, 0, -1, 1, -1, 0, 1, 0, -1, 0, 1, -1, 1, 0, 0, 0, 1, 0, 0, 0};
+constexpr int conn14[] = {0, 3, 4};
+constexpr Req reqs14[] = {Req::Unconnected, Req::LineTo, Req::LineTo};
+constexpr int args14[] = {0, 4, 3};
+/* Line 102 */
+constexpr int a15[] = {0, 0, -1, 0, 0, 0, 0, 0, -1, 0, 0, 0, 1, 1, 0, 1, -1, 0, 0, 0, -1, 0, 1, -1, 0, 0, 1, -1, 0, 1, 0, 0, 0, 1, -1, 0};
+constexpr int b15[] = {0, 1, 0, 0, -1, 0, -1, 0, -1, -1, 1, 0, 0, 1, 0, 0, 0, -1, 0, 1, 0, 0, -1, 0, 1, -1, 0, 1, 0, 1, 0, 0, 1, 0, -1, 0};
+constexpr int conn15[] = {5};
+constexpr Req reqs15[] = {Req::Line};
+constexpr int args15[] = {0};
+/* Line 107 */
+constexpr int a16[] = {0, 0, 1, 0, 0, 0, 0, 0, 1, 0, 0, 0, -1, -1, 0, -1, 1, 0, 0, 0, 1, 0, -1, 1, 0, 0, -1, 1, 0, -1, 0, 0, 0, -1, 1, 0};
+constexpr int b16[] = {0, -1, 0, 0, 1, 0, 1, 0, 1, 1, -1, 0, 0, -1, 0, 0, 0, 1, 0, -1, 0, 0, 1, 0, -1, 1, 0, -1, 0, -1, 0, 0, -1, 0, 1, 0};
+constexpr int conn16[] = {5};
+constexpr Req reqs16[] = {Req::Line};
+constexpr int args16[] = {0};
+/* Line 113 */
+constexpr int a17[] = {0, 1, 0, 0, 0, -1, 0, -1, 0, 0, 0, 1, 0, -1, 1, 0, 0, 1, 0, 0, 0, 0, -1, 0, 0};
+constexpr int b17[] = {0, -1, 1, 0, 0, 1, 0, -1, 1, 0, -1, 1, 0, 0, -1, 0, -1, 0, 0, 1, 0, 0, 1, -1, 0};
+constexpr int conn17[] = {0, 3, 4};
+constexpr Req reqs17[] = {Req::Unconnected, Req::Line, Req::Line};
+constexpr int args17[] = {0, 0, 0};
+/* Line 120 */
+constexpr int a18[] = {0, 1, 0, -1, -1, 0, -1, 1, 0, 1, 0, 0, 1, -1, 0, 0};
+constexpr int b18[] = {0, -1, 0, 0, 1, 0, 1, -1, 0, -1, 0, 1, 0, 1, -1, 0};
+constexpr int conn18[] = {0, 2, 3};
+constexpr Req reqs18[] = {Req::Unconnected, Req::Unconnected, Req::Unconnected};
+constexpr int args18[] = {0, 0, 0};
+/* Line 127 */
+constexpr int a19[] = {0, 1, 0, 0, -1, 0, 1, -1, 0, -1, 0, 1, 0, 1, -1, 0};
+constexpr int b19[] = {0, -1, 1, 0, 1, 0, -1, 1, -1, 1, 0, 0, 0, -1, 0, 0};
+constexpr int conn19[] = {0, 2, 3};
+constexpr Req reqs19[] = {Req::Unconnected, Req::LineTo, Req::LineTo};
+constexpr int args19[] = {0, 3, 2};
+/* Line 134 */
+constexpr int a20[] = {0, -1, 0, 0, 0, 0, 1, 0, 1, 0, 0, 0, 0, -1, 0, 1, -1, 0, 0, 0, -1, 0, 0, 0, 0, 0, 1, 0, 0, 1, 0, 0, 0, 0, -1, 0};
+constexpr int b20[] = {0, 1, -1, 0, 0, 0, -1, 0, 1, -1, 0, 0, 1, -1, 0, 1, -1, 1, 0, 1, -1, 0, 1, 0, 0, 0, 1, -1, 0, -1, 0, 0, -1, 0, 1, 0};
+constexpr int conn20[] = {0, 3, 5};
+constexpr Req reqs20[] = {Req::Line, Req::Line, Req::Line};
+constexpr int args20[] = {0, 0, 0};
+/* Line 141 */
+constexpr int a21[] = {0, 1, 0, 0, 0, 0, -1, 0, -1, 0, 0, 0, 0, 1, 0, -1, 1, 0, 0, 0, 1, 0, 0, 0, 0, 0, -1, 0, 0, -1, 0, 0, 0, 0, 1, 0};
+constexpr int b21[] = {0, -1, 1, 0, 0, 0, 1, 0, -1, 1, 0, 0, -1, 1, 0, -1, 1, -1, 0, -1, 1, 0, -1, 0, 0, 0, -1, 1, 0, 1, 0, 0, 1, 0, -1, 0};
+constexpr int conn21[] = {0, 3, 5};
+constexpr Req reqs21[] = {Req::Line, Req::Line, Req::Line};
+constexpr int args21[] = {0, 0, 0};
+/* Line 148 */
+constexpr int a22[] = {0, 0, 0, -1, 1, 0, 0, 0, 0, -1, 0, 0, 0, -1, 1, 1, 0, 1, 0, -1, -1, 1, -1, 1, 0};
+constexpr int b22[] = {0, 1, 0, 0, -1, -1, 0, -1, 0, 1, 0, 1, 0, 0, -1, 0, 0, 0, 0, 1, 1, -1, 1, -1, 0};
+constexpr int conn22[] = {0, 1, 2, 3};
+constexpr Req reqs22[] = {Req::Unconnected, Req::Unconnected, Req::Unconnected, Req::Unconnected};
+constexpr int args22[] = {0, 0, 0, 0};
+/* Line 157 */
+constexpr int a23[] = {0, 1, 0, 0, 0, 0, 0, 0, -1, 0, -1, 1, 0, 0, 0, 0, 0, 1, 0, 0, 0, 0, 0, 0, 0, -1, 0, 0, -1, 0, 0, 0, 0, 0, 0, 1, 0, 1, -1, 0, 0, 0, 0, 0, -1, 0, 0, 0, 0, 0, 0, 0, 1, 0, 0, 1, 0, 0, 0, 0, 0, 0, -1, 0};
+constexpr int b23[] = {0, -1, 0, 0, 1, 0, 0, 0, 1, 0, 1, 1, -1, 0, 0, 0, 0, -1, 0, 0, 1, 0, 0, 0, 0, -1, 0, 0, 0, 0, 1, 0, -1, 1, -1, 0, 0, -1, 0, 0, 0, 0, 0, 0, 1, 0, -1, 0, 0, 0, 0, -1, 0, 1, 0, 1, 0, 0, 0, 0, 0, 0, -1, 0};
+/* Line 161 */
+constexpr int a24[] = {0, 1, 0, 0, -1, 0, 0, -1, -1, 0, -1, 0, 1, 0, -1, 0, 0, 1, 0, -1, 0, 0, 0, 0, 0, 0, 1, 0, -1, 0, 0, 0, 1, -1, 0, 1, 0, 1, 0, 0, 0, 0, 0, 0, -1, 0, 1, 0, 0, 1, 0, 0, 0, -1, 0, 0, 1, 0, 0, 0, 0, 0, 0, 0};
+constexpr int b24[] = {0, 0, 0, 0, 1, 0, 0, -1, 0, 0, -1, 1, -1, 1, -1, 0, 0, 1, 0, -1, 0, 0, 0, 0, 0, -1, 1, 0, 1, 0, 0, 0, -1, 1, 0, -1, 0, -1, 0, 0, 0, -1, 0, 0, 1, 0, 1, 0, 0, 1, 0, 0, 0, -1, 0, 0, 1, 0, 0, 0, 0, 0, 0, 0};
+/* Line 166 */
+constexpr int a25[] = {0, 1, 0, 0, 0, -1, -1, 0, -1, 0, 0, 1, 0, 1, 0, -1, 0, 0, 0, 0, 1, 0, -1, 0, 0, 0, 0, 1, 0, -1, 1, -1, 0, 0, 1, 0};
+constexpr int b25[] = {0, 0, 0, 0, 0, 1, 0, 0, -1, 0, 1, -1, 0, 1, 0, -1, 0, 0, 0, 0, 1, 0, -1, 0, 0, -1, 0, 1, 0, 1, -1, 1, 0, 0, -1, 0};
+constexpr int conn25[] = {0, 3, 4};
+constexpr Req reqs25[] = {Req::Unconnected, Req::Line, Req::Unconnected};
+constexpr int args25[] = {0, 0, 0};
+/* Line 173 */
+constexpr int a26[] = {0, -1, 1, -1, 0, 1, 0, -1, 0, 0, -1, 1, 0, 1, -1, 1, 0, -1, 0, 1, 0, 0, 1, -1, 0};
+constexpr int b26[] = {0, -1, 0, 0, 0, 1, 0, -1, 1, 0, 0, 1, 0, 0, 0, 0, -1, 0, 0, 1, 0, 0, 0, -1, 0};
+constexpr int conn26[] = {0, 4};
+constexpr Req reqs26[] = {Req::Line, Req::Line};
+constexpr int args26[] = {0, 0};
+/* Line 179 */
+constexpr int a27[] = {0, 1, -1, 1, 0, -1, 0, 1, 0, 0, 1, -1, 0, -1, 1, -1, 0, 1, 0, -1, 0, 0, -1, 1, 0};
+constexpr int b27[] = {0, 1, 0, 0, 0, -1, 0, 1, -1, 0, 0, -1, 0, 0, 0, 0, 1, 0, 0, -1, 0, 0, 0, 1, 0};
+constexpr int conn27[] = {0, 4};
+constexpr Req reqs27[] = {Req::Line, Req::Line};
+constexpr int args27[] = {0, 0};
+/* Line 185 */
+constexpr int a28[] = {0, -1, 0, 1, 1, 0, -1, 0, 0, 1, 0, -1, -1, 0, 1, 0};
+constexpr int b28[] = {0, 1, 0, 0, -1, 0, 1, 1, 0, -1, 0, 0, 0, -1, 0, 0};
+constexpr int conn28[] = {0, 3};
+constexpr Req reqs28[] = {Req::Line, Req::Line};
+constexpr int args28[] = {0, 0};
+/* Line 191 */
+constexpr int a29[] = {0, -1, 1, 0, 0, 0, 1, 0, -1, 0, 0, 0, -1, 1, 0, 1, 0, 0, 0, 0, -1, 0, 1, 1, 0, 0, 0, -1, 0, 0, 0, 0, 0, -1, 0, 0};
+constexpr int b29[] = {0, -1, 1, 0, 0, 0, 1, 0, -1, 0, 0, 0, -1, 1, 0, -1, 1, 1, 0, 0, 1, 0, -1, -1, 0, 0, -1, 1, 0, 0, 0, 0, -1, 1, 0, 0};
+constexpr int conn29[] = {0, 1, 5};
+constexpr Req reqs29[] = {Req::ConnectedTo, Req::Line, Req::ConnectedTo};
+constexpr int args29[] = {5, 0, 0};
+/* Line 198 */
+constexpr int a30[] = {0, 1, -1, 0, 0, 0, -1, 0, 1, 0, 0, 0, 1, -1, 0, -1, 0, 0, 0, 0, 1, 0, -1, -1, 0, 0, 0, 1, 0, 0, 0, 0, 0, 1, 0, 0};
+constexpr int b30[] = {0, 1, -1, 0, 0, 0, -1, 0, 1, 0, 0, 0, 1, -1, 0, 1, -1, -1, 0, 0, -1, 0, 1, 1, 0, 0, 1, -1, 0, 0, 0, 0, 1, -1, 0, 0};
+constexpr int conn30[] = {0, 1, 5};
+constexpr Req reqs30[] = {Req::ConnectedTo, Req::Line, Req::ConnectedTo};
+constexpr int args30[] = {5, 0, 0};
+/* Line 205 */
+constexpr int a31[] = {0, 1, -1, 0, 0, 0, -1, 0, 1, -1, 0, 0, 1, -1, 0, 1, -1, 0, 0, 1, -1, 0, 1, -1, 0, 0, 1, -1, 0, 1, 0, 0, 0, 1, -1, 0};
+constexpr int b31[] = {0, -1, 0, 0, 0, 0, 1, 0, 1, 0, 0, 0, 0, -1, 0, 1, -1, 0, 0, 0, -1, 0, 0, 0, 0, 0, 1, 0, 0, -1, 0, 0, 0, 0, 1, 0};
+constexpr int conn31[] = {0, 5};
+constexpr Req reqs31[] = {Req::Line, Req::Line};
+constexpr int args31[] = {0, 0};
+/* Line 211 */
+constexpr int a32[] = {0, -1, 1, 0, 0, 0, 1, 0, -1, 1, 0, 0, -1, 1, 0, -1, 1, 0, 0, -1, 1, 0, -1, 1, 0, 0, -1, 1, 0, -1, 0, 0, 0, -1, 1, 0};
+constexpr int b32[] = {0, 1, 0, 0, 0, 0, -1, 0, -1, 0, 0, 0, 0, 1, 0, -1, 1, 0, 0, 0, 1, 0, 0, 0, 0, 0, -1, 0, 0, 1, 0, 0, 0, 0, -1, 0};
+constexpr int conn32[] = {0, 5};
+constexpr Req reqs32[] = {Req::Line, Req::Line};
+constexpr int args32[] = {0, 0};
+/* Line 217 */
+constexpr int a33[] = {0, 1, -1, 0, 0, 0, -1, 0, 1, 1, 0, -1, 1, -1, 0, 0, -1, 1, 0, -1, 0, 0, 0, 1, 0, 0, 1, 0, 0, -1, 0, 1, -1, -1, 1, 0};
+constexpr int b33[] = {0, 1, 0, 0, 0, 0, -1, 0, -1, 0, 0, 0, 0, 1, 0, -1, 0, 0, 0, 0, 1, 0, -1, 1, 0, 0, 0, 1, 0, 0, 0, 0, 0, -1, 0, 0};
+constexpr int conn33[] = {0, 5};
+constexpr Req reqs33[] = {Req::Line, Req::Line};
+constexpr int args33[] = {0, 0};
+/* Line 223 */
+constexpr int a34[] = {0, -1, 0, 1, 0, 0, 0, 1, 0, -1, -1, 1, 0, 0, 0, 1, 0, 0, 0, 0, 0, -1, 1, 0, 0, -1, 1, -1, 0, -1, 0, 1, 0, -1, 0, 0, 0, 0, -1, 1, 0, 1, 0, 0, 0, 1, 0, -1, 0};
+constexpr int b34[] = {0, 1, 0, 0, 0, 0, 0, -1, 0, -1, 0, 0, 0, 0, 0, 1, 0, -1, -1, 0, 0, 0, 0, 1, 0, 0, 0, 0, 0, 0, 1, 0, 0, 1, 0, 0, 0, 0, 0, -1, 0, 1, 0, 0, 0, 0, 0, -1, 0};
+constexpr int conn34[] = {0, 6};
+constexpr Req reqs34[] = {Req::Line, Req::Line};
+constexpr int args34[] = {0, 0};
+/* Line 229 */
+constexpr int a35[] = {0, 1, 0, -1, 0, 0, 0, -1, 0, 1, 1, -1, 0, 0, 0, -1, 0, 0, 0, 0, 0, 1, -1, 0, 0, 1, -1, 1, 0, 1, 0, -1, 0, 1, 0, 0, 0, 0, 1, -1, 0, -1, 0, 0, 0, -1, 0, 1, 0};
+constexpr int b35[] = {0, -1, 0, 0, 0, 0, 0, 1, 0, 1, 0, 0, 0, 0, 0, -1, 0, 1, 1, 0, 0, 0, 0, -1, 0, 0, 0, 0, 0, 0, -1, 0, 0, -1, 0, 0, 0, 0, 0, 1, 0, -1, 0, 0, 0, 0, 0, 1, 0};
+constexpr int conn35[] = {0, 6};
+constexpr Req reqs35[] = {Req::Line, Req::Line};
+constexpr int args35[] = {0, 0};
+/* Line 235 */
+constexpr int a36[] = {0, 1, -1, 0, 0, 0, -1, 0, 1, -1, 0, 0, 1, -1, 0, 0, -1, 1, 0, 1, 0, 0, 0, -1, 0, 0, 1, 0, 0, -1, 0, 0, -1, 1, 1, 0};
+constexpr int b36[] = {0, 1, 0, 0, 0, 0, -1, 0, 1, 0, 0, 0, 0, -1, 0, -1, 0, 0, 0, 0, 1, 0, 1, -1, 0, 0, 0, -1, 0, 0, 0, 0, 0, 1, 0, 0};
+constexpr int conn36[] = {0, 5};
+constexpr Req reqs36[] = {Req::Line, Req::Line};
+constexpr int args36[] = {0, 0};
+/* Line 241 */
+constexpr int a37[] = {0, -1, 1, 0, 0, 0, 1, 0, -1, 1, 0, 0, -1, 1, 0, 0, 1, -1, 0, -1, 0, 0, 0, 1, 0, 0, -1, 0, 0, 1, 0, 0, 1, -1, -1, 0};
+constexpr int b37[] = {0, -1, 0, 0, 0, 0, 1, 0, -1, 0, 0, 0, 0, 1, 0, 1, 0, 0, 0, 0, -1, 0, -1, 1, 0, 0, 0, 1, 0, 0, 0, 0, 0, -1, 0, 0};
+constexpr int conn37[] = {0, 5};
+constexpr Req reqs37[] = {Req::Line, Req::Line};
+constexpr int args37[] = {0, 0};
+/* Line 247 */
+constexpr int a38[] = {0, 1, -1, 0, 0, 0, -1, 0, 1, 0, 0, -1, 1, -1, 0, -1, 1, 0, 0, 0, 1, 0, 0, 0, 0, 0, -1, 0, 0, 1, 0, 1, 0, 0, -1, 0};
+constexpr int b38[] = {0, 0, -1, 0, 0, 0, 0, 0, -1, -1, 1, 0, 1, 1, 0, 0, 0, 0, 0, 1, 0, 0, 0, -1, 0, -1, 0, 0, 0, 0, 0, 0, 0, 1, 0, 0};
+constexpr int conn38[] = {0, 5};
+constexpr Req reqs38[] = {Req::Line, Req::Line};
+constexpr int args38[] = {0, 0};
+/* Line 253 */
+constexpr int a39[] = {0, -1, 1, 0, 0, 0, 1, 0, -1, 0, 0, 1, -1, 1, 0, 1, -1, 0, 0, 0, -1, 0, 0, 0, 0, 0, 1, 0, 0, -1, 0, -1, 0, 0, 1, 0};
+constexpr int b39[] = {0, 0, 1, 0, 0, 0, 0, 0, 1, 1, -1, 0, -1, -1, 0, 0, 0, 0, 0, -1, 0, 0, 0, 1, 0, 1, 0, 0, 0, 0, 0, 0, 0, -1, 0, 0};
+constexpr int conn39[] = {0, 5};
+constexpr Req reqs39[] = {Req::Line, Req::Line};
+constexpr int args39[] = {0, 0};
+/* Line 259 */
+constexpr int a40[] = {0, -1, 0, 1, 0, 0, 0, 1, 0, 1, -1, 0, 0, 0, 0, -1, 0, 1, 0, -1, 0, -1, 1, -1, 0, 1, 0, 0, 0, 0, 0, -1, 0, 1, -1, 0, 0, 1, 0, -1, 0, 1, 0, 0, 0, 0, 1, -1, 0};
+constexpr int b40[] = {0, 1, 0, 0, 0, 0, 0, -1, 0, -1, 0, 0, 0, 0, 0, 1, 0, -1, -1, 0, 0, 0, 0, 1, 0, 0, 0, 0, 0, 0, 1, 0, 0, 1, 0, 0, 0, 0, 0, -1, 0, 1, 0, 0, 0, 0, 0, -1, 0};
+constexpr int conn40[] = {0, 6};
+constexpr Req reqs40[] = {Req::Line, Req::Line};
+constexpr int args40[] = {0, 0};
+/* Line 265 */
+constexpr int a41[] = {0, 1, 0, -1, 0, 0, 0, -1, 0, -1, 1, 0, 0, 0, 0, 1, 0, -1, 0, 1, 0, 1, -1, 1, 0, -1, 0, 0, 0, 0, 0, 1, 0, -1, 1, 0, 0, -1, 0, 1, 0, -1, 0, 0, 0, 0, -1, 1, 0};
+constexpr int b41[] = {0, -1, 0, 0, 0, 0, 0, 1, 0, 1, 0, 0, 0, 0, 0, -1, 0, 1, 1, 0, 0, 0, 0, -1, 0, 0, 0, 0, 0, 0, -1, 0, 0, -1, 0, 0, 0, 0, 0, 1, 0, -1, 0, 0, 0, 0, 0, 1, 0};
+constexpr int conn41[] = {0, 6};
+constexpr Req reqs41[] = {Req::Line, Req::Line};
+constexpr int args41[] = {0, 0};
+/* Line 271 */
+constexpr int a42[] = {0, -1, 1, 0, 0, 0, 0, 0, 1, 0, -1, 1, 0, 0, 0, 0, -1, 1, 0, 0, -1, 0, 0, 0, 0, -1, 0, 0, 1, -1, 0, 0, 0, 0, 1, -1, 0, 0, 1, 0, 0, 0, 0, 1, 0, 0, -1, 1, 0, 0, 0, 0, -1, 1, 0, -1, 0, 0, 0, 0, 0, -1, 1, 0};
+constexpr int b42[] = {0, 1, 0, 0, 0, 0, 0, 0, -1, 0, -1, 0, 0, 0, 0, 0, 0, 1, 0, 1, 0, 0, 0, 0, 0, 0, -1, 0, 1, -1, 0, 0, 0, 0, 0, -1, 0, 0, 0, 0, 0, 0, 0, 1, 0, 0, 1, 0, 0, 0, 0, 0, 0, -1, 0, -1, 0, 0, 0, 0, 0, 0, 1, 0};
+constexpr int conn42[] = {0, 7};
+constexpr Req reqs42[] = {Req::Line, Req::Line};
+constexpr int args42[] = {0, 0};
+/* Line 277 */
+constexpr int a43[] = {0, -1, 1, 0, 0, -1, 1, 0, -1, 0, 0, 0, -1, 1, 0, 1, 0, 0, 0, 0, -1, 0, 1, 1, 0, 0, 0, -1, 0, 0, 1, 0, 0, -1, 0, 0};
+constexpr int b43[] = {0, -1, 1, 0, 0, -1, 1, 0, -1, 0, 0, 0, -1, 1, 0, -1, 1, 1, 0, 0, 1, 0, -1, -1, 0, 0, -1, 1, 0, 0, 1, 0, -1, 1, 0, 0};
+constexpr int conn43[] = {0, 1, 5};
+constexpr Req reqs43[] = {Req::ConnectedTo, Req::Line, Req::ConnectedTo};
+constexpr int args43[] = {5, 0, 0};
+/* Line 285 */
+constexpr int a44[] = {0, -1, 0, 0, 0, 0, 0, 0, 0, 1, 0, 1, 0, 0, 0, -1, 0, 0, 0, -1, 0, -1, 0, 0, 1, 0, 0, 0, 0, 1, 0, -1, 0, 0, 1, 0, 0, 0, 0, 1, 0, -1, 0, 0, 0, 0, 0, 0, 0, 1, 0, -1, 0, 1, 0, 1, -1, 0, 0, 1, 0, 0, 0, 0, 0, 0, -1, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, -1, 0, 0, 0};
+constexpr int b44[] = {0, 1, 0, 0, 0, 0, 0, 0, 0, -1, 0, 1, 0, 0, 0, 0, 0, 0, 0, -1, 0, -1, 0, 0, 0, 0, 0, 0, 0, 1, 0, 1, 0, 0, 0, 0, 0, 0, 0, -1, 0, -1, 1, 0, 0, 0, 0, 0, 0, 1, 0, 0, 0, 0, 0, 0, 0, 0, -1, 0, 0, 1, 0, 0, 0, 0, 0, 0, 0, -1, 0, -1, 0, 0, 0, 0, 0, 0, 0, 1, 0};
+/* Line 290 */
+constexpr int a45[] = {0, 1, 0, -1, 0, 1, 0, -1, 0};
+constexpr int b45[] = {0, -1, 1, 1, 0, -1, -1, 1, 0};
+constexpr int conn45[] = {0, 2};
+constexpr Req reqs45[] = {Req::ConnectedTo, Req::ConnectedTo};
+constexpr int args45[] = {2, 0};
+constexpr int atob45[] = {0, 0, 1, 0, 0, 0, -1, 0, 0};
+constexpr int btoa45[] = {0, 0, 0, 0, 0, 0, 0, 0, 0};
+/* Line 298 */
+constexpr int a46[] = {0, -1, 0, 1, 0, -1, 0, 1, 0};
+constexpr int b46[] = {0, 1, -1, -1, 0, 1, 1, -1, 0};
+constexpr int conn46[] = {0, 2};
+constexpr Req reqs46[] = {Req::ConnectedTo, Req::ConnectedTo};
+constexpr int args46[] = {2, 0};
+constexpr int atob46[] = {0, 0, -1, 0, 0, 0, 1, 0, 0};
+constexpr int btoa46[] = {0, 0, 0, 0, 0, 0, 0, 0, 0};
+/* Line 307 */
+constexpr int a47[] = {0, 1, -1, 0, 0, -1, 0, 1, 0, -1, 1, -1, 0, 1, 0, 0, 0, -1, 0, 1, 0, 1, 0, -1, 0};
+constexpr int b47[] = {0, -1, 0, 0, 0, 1, 0, -1, 0, 1, 0, 1, 0, 1, -1, 0, 0, -1, 0, 1, 0, -1, 1, -1, 0};
+constexpr int conn47[] = {2, 4};
+constexpr Req reqs47[] = {Req::Unconnected, Req::Unconnected};
+constexpr int args47[] = {0, 0};
+constexpr int atob47[] = {0, 0, 0, 0, 0, 0, 0, -1, 0, 0, 0, 1, 0, 1, 0, 0, 0, -1, 0, 1, 0, 0, 0, -1, 0};
+/* Line 314 */
+constexpr int a48[] = {0, -1, 1, 0, 0, 1, 0, -1, 0, 1, -1, 1, 0, -1, 0, 0, 0, 1, 0, -1, 0, -1, 0, 1, 0};
+constexpr int b48[] = {0, 1, 0, 0, 0, -1, 0, 1, 0, -1, 0, -1, 0, -1, 1, 0, 0, 1, 0, -1, 0, 1, -1, 1, 0};
+constexpr int conn48[] = {2, 4};
+constexpr Req reqs48[] = {Req::Unconnected, Req::Unconnected};
+constexpr int args48[] = {0, 0};
+constexpr int atob48[] = {0, 0, 0, 0, 0, 0, 0, 1, 0, 0, 0, -1, 0, -1, 0, 0, 0, 1, 0, -1, 0, 0, 0, 1, 0};
+/* Line 321 */
+constexpr int a49[] = {0, -1, 0, 0, 0, 0, 0, 0, 1, 0, -1, 0, 0, 0, 0, 1, 0, 1, 0, 1, 0, 0, 0, -1, 0, 0, -1, 0, 1, 0, 0, 0, 0, 0, 0, -1, 0, 1, 0, 0, 0, 0, 0, 0, -1, 0, 1, 0, 0, 0, 0, 0, 0, -1, 0, 0, 0, -1, 1, 0, 0, 0, 0, 0};
+constexpr int b49[] = {0, 1, -1, 0, 0, 0, 0, 0, -1, 0, 1, 0, 0, 0, 0, -1, 1, -1, 0, 1, 0, 0, 0, 0, 0, 0, -1, 0, 1, 0, 0, 0, 0, 0, 0, -1, 0, 1, 0, 0, 0, 0, 0, 0, -1, 0, 1, 0, 0, 0, 0, 0, 0, -1, 0, 0, 0, 1, 0, 0, 0, 0, 0, 0};
+constexpr int conn49[] = {0, 5, 7};
+constexpr Req reqs49[] = {Req::Line, Req::LineTo, Req::LineTo};
+constexpr int args49[] = {0, 7, 5};
+constexpr int atob49[] = {0, 0, -1, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 1, 0, 0, 1, 0, 0, 0, 0, 0, 0, -1, 0, 1, 0, 0, 0, 0, 0, 0, -1, 0, 1, 0, 0, 0, 0, 0, 0, -1, 0, 1, 0, 0, 0, 0, 0, 0, -1, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0};
+/* Line 329 */
+constexpr int a50[] = {0, 1, 0, 0, 0, 0, 0, 0, -1, 0, 1, 0, 0, 0, 0, -1, 0, -1, 0, -1, 0, 0, 0, 1, 0, 0, 1, 0, -1, 0, 0, 0, 0, 0, 0, 1, 0, -1, 0, 0, 0, 0, 0, 0, 1, 0, -1, 0, 0, 0, 0, 0, 0, 1, 0, 0, 0, 1, -1, 0, 0, 0, 0, 0};
+constexpr int b50[] = {0, -1, 1, 0, 0, 0, 0, 0, 1, 0, -1, 0, 0, 0, 0, 1, -1, 1, 0, -1, 0, 0, 0, 0, 0, 0, 1, 0, -1, 0, 0, 0, 0, 0, 0, 1, 0, -1, 0, 0, 0, 0, 0, 0, 1, 0, -1, 0, 0, 0, 0, 0, 0, 1, 0, 0, 0, -1, 0, 0, 0, 0, 0, 0};
+constexpr int conn50[] = {0, 5, 7};
+constexpr Req reqs50[] = {Req::Line, Req::LineTo, Req::LineTo};
+constexpr int args50[] = {0, 7, 5};
+constexpr int atob50[] = {0, 0, 1, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, -1, 0, 0, -1, 0, 0, 0, 0, 0, 0, 1, 0, -1, 0, 0, 0, 0, 0, 0, 1, 0, -1, 0, 0, 0, 0, 0, 0, 1, 0, -1, 0, 0, 0, 0, 0, 0, 1, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0};
+/* Line 337 */
+constexpr int a51[] = {0, -1, 0, 0, 0, 0, 0, 1, 0, -1, 0, 0, 1, 0, 0, 1, 0, 1, 0, -1, 0, 0, 0, -1, 0, 1, 0, 0, 0, 0, 0, -1, 0, 1, 0, 0, -1, 1, 0, -1, 0, 1, 0, 0, 0, 0, 0, -1, 0};
+constexpr int b51[] = {0, 1, -1, 0, 0, 0, 0, -1, 0, 1, 0, 0, -1, 0, 1, -1, 0, 1, 0, 0, 0, 0, 0, -1, 0, 1, 0, 0, 0, 0, 0, -1, 0, 1, 0, 0, 1, 0, 0, -1, 0, 1, 0, 0, 0, 0, 0, -1, 0};
+constexpr int conn51[] = {0};
+constexpr Req reqs51[] = {Req::Line};
+constexpr int args51[] = {0};
+/* Line 342 */
+constexpr int a52[] = {0, -1, 0, 0, 0, 0, 0, 0, 1, 0, 1, -1, 0, 0, 0, 0, 0, -1, 0, 1, 0, 0, -1, 0, 0, 1, -1, 0, 1, 0, 0, 0, 0, 0, 0, -1, 0, 1, 0, 0, 0, 0, 0, 0, -1, 0, 1, 0, 0, 0, 1, 0, 0, -1, 0, 1, 0, 0, 0, 0, 0, 0, -1, 0};
+constexpr int b52[] = {0, 1, 0, -1, 0, 0, 0, 0, -1, 0, -1, 1, 0, 0, 0, 0, 0, 1, 0, 0, 0, 0, -1, 0, 1, -1, 0, 0, 1, 0, 0, 0, 0, 0, 0, -1, 0, 1, 0, 0, 0, 0, 0, 0, -1, 0, 1, 0, 0, 0, 1, 0, 0, -1, 0, 1, 0, 0, 0, 0, 0, 0, -1, 0};
+constexpr int conn52[] = {0};
+constexpr Req reqs52[] = {Req::Line};
+constexpr int args52[] = {0};
+/* Line 347 */
+constexpr int a53[] = {0, 1, 0, 0, 0, 0, 0, 0, -1, 0, -1, 1, 0, 0, 0, 0, 0, 1, 0, -1, 0, 0, 1, 0, 0, -1, 1, 0, -1, 0, 0, 0, 0, 0, 0, 1, 0, -1, 0, 0, 0, 0, 0, 0, 1, 0, -1, 0, 0, 0, -1, 0, 0, 1, 0, -1, 0, 0, 0, 0, 0, 0, 1, 0};
+constexpr int b53[] = {0, -1, 0, 1, 0, 0, 0, 0, 1, 0, 1, -1, 0, 0, 0, 0, 0, -1, 0, 0, 0, 0, 1, 0, -1, 1, 0, 0, -1, 0, 0, 0, 0, 0, 0, 1, 0, -1, 0, 0, 0, 0, 0, 0, 1, 0, -1, 0, 0, 0, -1, 0, 0, 1, 0, -1, 0, 0, 0, 0, 0, 0, 1, 0};
+constexpr int conn53[] = {0};
+constexpr Req reqs53[] = {Req::Line};
+constexpr int args53[] = {0};
+/* Line 353 */
+constexpr int a54[] = {0, 1, 0, 0, 0, 0, -1, 0, 1, 0, 0, 0, 0, -1, 0, -1, 0, 1, 0, 0, 1, 0, 1, -1, 0, 0, 0, -1, 0, 0, 0, 0, -1, 1, 0, 0};
+constexpr int b54[] = {0, -1, 1, 0, 0, 0, 1, 0, -1, 0, 0, 0, -1, 1, 0, 1, 0, 0, 0, 0, -1, 0, -1, 1, 0, 0, 0, 1, 0, -1, 0, 0, 0, -1, 1, 0};
+constexpr int conn54[] = {0, 5, 4};
+constexpr Req reqs54[] = {Req::ConnectedTo, Req::ConnectedTo, Req::Line};
+constexpr int args54[] = {5, 0, 0};
+constexpr int atob54[] = {0, -1, 1, 0, 0, 0, 1, 0, -1, 0, 0, 0, -1, 1, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, -1, 0, 0, 0, 0, 1, 0};
+constexpr int btoa54[] = {0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, -1, 0, 1, 0, 0, 1, 0, 1, -1, 0, 0, 0, -1, 0, 0, 0, 0, -1, 1, 0, 0};
+/* Line 362 */
+constexpr int a55[] = {0, -1, 0, 0, 0, 0, 1, 0, -1, 0, 0, 0, 0, 1, 0, 1, 0, -1, 0, 0, -1, 0, -1, 1, 0, 0, 0, 1, 0, 0, 0, 0, 1, -1, 0, 0};
+constexpr int b55[] = {0, 1, -1, 0, 0, 0, -1, 0, 1, 0, 0, 0, 1, -1, 0, -1, 0, 0, 0, 0, 1, 0, 1, -1, 0, 0, 0, -1, 0, 1, 0, 0, 0, 1, -1, 0};
+constexpr int conn55[] = {0, 5, 4};
+constexpr Req reqs55[] = {Req::ConnectedTo, Req::ConnectedTo, Req::Line};
+constexpr int args55[] = {5, 0, 0};
+constexpr int atob55[] = {0, 1, -1, 0, 0, 0, -1, 0, 1, 0, 0, 0, 1, -1, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 1, 0, 0, 0, 0, -1, 0};
+constexpr int btoa55[] = {0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 1, 0, -1, 0, 0, -1, 0, -1, 1, 0, 0, 0, 1, 0, 0, 0, 0, 1, -1, 0, 0};
+/* Line 372 */
+constexpr int a56[] = {0, 1, 0, -1, 0, 0, -1, 0, 1, 1, 0, 0, 0, -1, 0, 0, 0, 0, 1, -1, 0, 0, 1, -1, 0, 0, 0, -1, 0, 1, 0, 0, 0, 1, -1, 0};
+constexpr int b56[] = {0, -1, 1, 0, 0, 0, 1, 0, -1, -1, 0, 0, -1, 1, 0, 0, 0, 0, 0, 1, 0, 0, 1, -1, 0, 0, 0, -1, 0, 1, 0, 0, 0, 1, -1, 0};
+constexpr int conn56[] = {0, 5, 2};
+constexpr Req reqs56[] = {Req::ConnectedTo, Req::ConnectedTo, Req::Line};
+constexpr int args56[] = {5, 0, 0};
+constexpr int atob56[] = {0, 0, 1, 0, 0, 0, 0, 0, 0, 0, 0, 0, -1, 0, 0, 0, 0, 0, 0, 0, 0, 0, -1, 0, 0, 0, 0, 1, 0, -1, 0, 0, 0, 0, 1, 0};
+/* Line 380 */
+constexpr int a57[] = {0, -1, 0, 1, 0, 0, 1, 0, -1, -1, 0, 0, 0, 1, 0, 0, 0, 0, -1, 1, 0, 0, -1, 1, 0, 0, 0, 1, 0, -1, 0, 0, 0, -1, 1, 0};
+constexpr int b57[] = {0, 1, -1, 0, 0, 0, -1, 0, 1, 1, 0, 0, 1, -1, 0, 0, 0, 0, 0, -1, 0, 0, -1, 1, 0, 0, 0, 1, 0, -1, 0, 0, 0, -1, 1, 0};
+constexpr int conn57[] = {0, 5, 2};
+constexpr Req reqs57[] = {Req::ConnectedTo, Req::ConnectedTo, Req::Line};
+constexpr int args57[] = {5, 0, 0};
+constexpr int atob57[] = {0, 0, -1, 0, 0, 0, 0, 0, 0, 0, 0, 0, 1, 0, 0, 0, 0, 0, 0, 0, 0, 0, 1, 0, 0, 0, 0, -1, 0, 1, 0, 0, 0, 0, -1, 0};
+/* Line 389 */
+constexpr int a58[] = {0, -1, 0, 0, 0, 1, 0, 1, 0, -1, 0, -1, 0, -1, 1, 0, 0, 1, 0, 0, 0, 1, -1, 0, 0};
+constexpr int b58[] = {0, 1, -1, 0, 0, -1, 0, 1, 0, 0, 1, -1, 0, 1, -1, 0, 0, -1, 0, 1, 0, 0, 1, -1, 0};
+constexpr int conn58[] = {0, 4, 3};
+constexpr Req reqs58[] = {Req::ConnectedTo, Req::ConnectedTo, Req::Line};
+constexpr int args58[] = {4, 0, 0};
+constexpr int atob58[] = {0, 1, 0, 0, 0, -1, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 1, 0, 0, 0, -1, 0};
+constexpr int btoa58[] = {0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 1, 0, 0, 0, -1, 0, 1, 0, 0, 0, -1, 0};
+/* Line 398 */
+constexpr int a59[] = {0, 1, 0, 0, 0, -1, 0, -1, 0, 1, 0, 1, 0, 1, -1, 0, 0, -1, 0, 0, 0, -1, 1, 0, 0};
+constexpr int b59[] = {0, -1, 1, 0, 0, 1, 0, -1, 0, 0, -1, 1, 0, -1, 1, 0, 0, 1, 0, -1, 0, 0, -1, 1, 0};
+constexpr int conn59[] = {0, 4, 3};
+constexpr Req reqs59[] = {Req::ConnectedTo, Req::ConnectedTo, Req::Line};
+constexpr int args59[] = {4, 0, 0};
+constexpr int atob59[] = {0, -1, 0, 0, 0, 1, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, -1, 0, 0, 0, 1, 0};
+constexpr int btoa59[] = {0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, -1, 0, 0, 0, 1, 0, -1, 0, 0, 0, 1, 0};
+/* Line 408 */
+constexpr int a60[] = {0, -1, 0, 0, 0, 0, 1, 0, 1, 0, 1, 0, 0, 0, -1, 0, 0, -1, 0, 1, 0, 0, 0, 0, 0, 0, -1, 0, -1, 0, 1, 0, 0, 0, 0, 1, 0, 1, -1, -1, 0, 0, 0, 0, -1, 0, 1, 0, -1, 1, 0, -1, 1, -1, 0, 0, 0, 0, 0, 0, 1, 0, 0, 0};
+constexpr int b60[] = {0, -1, 0, 0, 0, 0, 0, 0, 1, 0, -1, 0, 0, 0, 1, 0, 0, 1, 0, 1, 0, 0, -1, 0, 0, 0, -1, 0, 1, 0, 0, 0, 0, 0, 0, -1, 0, 0, 1, -1, 0, 0, 0, 0, 0, 0, 1, -1, 0, -1, 1, 0, -1, -1, 0, 1, 0, 0, 0, 0, 1, 1, -1, 0};
+constexpr int conn60[] = {0, 7};
+constexpr Req reqs60[] = {Req::Line, Req::Line};
+constexpr int args60[] = {0, 0};
+constexpr int atob60[] = {0, -1, 0, 0, 0, 0, 0, 0, 1, 0, -1, 0, 0, 0, 0, 0, 0, 1, 0, 1, 0, 0, 0, 0, 0, 0, -1, 0, 1, 0, 0, 0, 0, 0, 0, -1, 0, 0, 0, -1, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, -1, 0, 0, 0, 0, 1, 0, 1, 0};
+constexpr int btoa60[] = {0, -1, 0, 0, 0, 0, 0, 0, 1, 0, 1, 0, 0, 0, 0, 0, 0, -1, 0, 1, 0, 0, 0, 0, 0, 0, -1, 0, -1, 0, 0, 0, 0, 0, 0, 1, 0, 1, 0, -1, 0, 0, 0, 0, -1, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 1, 0, 0, 0};
+/* Line 416 */
+constexpr int a61[] = {0, 1, 0, 0, 0, 0, -1, 0, -1, 0, -1, 0, 0, 0, 1, 0, 0, 1, 0, -1, 0, 0, 0, 0, 0, 0, 1, 0, 1, 0, -1, 0, 0, 0, 0, -1, 0, -1, 1, 1, 0, 0, 0, 0, 1, 0, -1, 0, 1, -1, 0, 1, -1, 1, 0, 0, 0, 0, 0, 0, -1, 0, 0, 0};
+constexpr int b61[] = {0, 1, 0, 0, 0, 0, 0, 0, -1, 0, 1, 0, 0, 0, -1, 0, 0, -1, 0, -1, 0, 0, 1, 0, 0, 0, 1, 0, -1, 0, 0, 0, 0, 0, 0, 1, 0, 0, -1, 1, 0, 0, 0, 0, 0, 0, -1, 1, 0, 1, -1, 0, 1, 1, 0, -1, 0, 0, 0, 0, -1, -1, 1, 0};
+constexpr int conn61[] = {0, 7};
+constexpr Req reqs61[] = {Req::Line, Req::Line};
+constexpr int args61[] = {0, 0};
+constexpr int atob61[] = {0, 1, 0, 0, 0, 0, 0, 0, -1, 0, 1, 0, 0, 0, 0, 0, 0, -1, 0, -1, 0, 0, 0, 0, 0, 0, 1, 0, -1, 0, 0, 0, 0, 0, 0, 1, 0, 0, 0, 1, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 1, 0, 0, 0, 0, -1, 0, -1, 0};
+constexpr int btoa61[] = {0, 1, 0, 0, 0, 0, 0, 0, -1, 0, -1, 0, 0, 0, 0, 0, 0, 1, 0, -1, 0, 0, 0, 0, 0, 0, 1, 0, 1, 0, 0, 0, 0, 0, 0, -1, 0, -1, 0, 1, 0, 0, 0, 0, 1, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, -1, 0, 0, 0};
+/* Line 424 */
+constexpr int a62[] = {0, 1, 0, -1, 0, 1, -1, 0, 1, 1, 0, 0, 0, -1, 0, 0, 0, 0, 1, -1, 0, 0, 1, -1, 0, 0, 0, -1, 0, 1, -1, 0, 0, 1, -1, 0};
+constexpr int b62[] = {0, -1, 1, 0, 0, 1, 1, 0, -1, -1, 0, 0, -1, 1, 0, 0, 0, 0, 0, 1, 0, 0, 1, -1, 0, 0, 0, -1, 0, 1, -1, 0, 0, 1, -1, 0};
+constexpr int conn62[] = {0, 5, 2, 4};
+constexpr Req reqs62[] = {Req::ConnectedTo, Req::ConnectedTo, Req::Line, Req::Line};
+constexpr int args62[] = {5, 0, 0, 0};
+constexpr int atob62[] = {0, 0, 1, 0, 0, 1, 0, 0, 0, 0, 0, 0, -1, 0, 0, 0, 0, 0, 0, 0, 0, 0, 1, -1, 0, 0, 0, -1, 0, 1, -1, 0, 0, 1, -1, 0};
+/* Line 433 */
+constexpr int a63[] = {0, -1, 0, 1, 0, -1, 1, 0, -1, -1, 0, 0, 0, 1, 0, 0, 0, 0, -1, 1, 0, 0, -1, 1, 0, 0, 0, 1, 0, -1, 1, 0, 0, -1, 1, 0};
+constexpr int b63[] = {0, 1, -1, 0, 0, -1, -1, 0, 1, 1, 0, 0, 1, -1, 0, 0, 0, 0, 0, -1, 0, 0, -1, 1, 0, 0, 0, 1, 0, -1, 1, 0, 0, -1, 1, 0};
+constexpr int conn63[] = {0, 5, 2, 4};
+constexpr Req reqs63[] = {Req::ConnectedTo, Req::ConnectedTo, Req::Line, Req::Line};
+constexpr int args63[] = {5, 0, 0, 0};
+constexpr int atob63[] = {0, 0, -1, 0, 0, -1, 0, 0, 0, 0, 0, 0, 1, 0, 0, 0, 0, 0, 0, 0, 0, 0, -1, 1, 0, 0, 0, 1, 0, -1, 1, 0, 0, -1, 1, 0};
+/* Line 443 */
+constexpr int a64[] = {0, -1, 0, 0, 0, 0, 0, 0, 0, 0, 1, 0, -1, 0, 0, 0, 0, 0, 0, 0, 0, 1, 0, -1, 0, 0, 0, 0, 0, 1, 0, 0, 1, 0, 1, 0, 0, 0, 0, -1, 0, 0, 0, -1, 0, 1, 0, 0, 0, 0, 0, 0, 0, 0, -1, 0, -1, 0, 1, 0, 0, 0, 0, 0, 0, 1, 0, 1, -1, 0, 0, 0, 0, 0, 0, 0, -1, 0, 1, 0, 0, 0, 0, 0, 0, -1, 1, -1, 0, 1, 0, 0, -1, 1, 0, 0, 0, 0, -1, 0};
+constexpr int b64[] = {0, -1, 0, 0, 0, 0, 0, 0, 0, 0, 1, 0, -1, 0, 0, 0, 0, 0, 0, 1, 0, 1, 0, 1, 0, 0, 0, 0, 0, -1, 0, 0, -1, 0, 1, 0, 0, 0, 0, 0, 0, 0, 0, -1, 0, -1, 0, 0, 1, 0, 0, 0, 0, 0, 1, 0, -1, 1, -1, 0, 0, 0, 0, 0, 0, 1, 0, 0, 0, 0, 0, 0, 0, 0, 0, -1, 0, 0, 1, 0, 0, 0, 0, 0, -1, 1, 0, -1, 0, 1, 0, -1, 1, 0, 0, 0, 0, 0, -1, 0};
+/* Line 447 */
+constexpr int a65[] = {0, 1, 0, 0, 0, 0, 0, 0, 0, 0, -1, 0, 1, 0, 0, 0, 0, 0, 0, 0, 0, -1, 0, 1, 0, 0, 0, 0, 0, -1, 0, 0, -1, 0, -1, 0, 0, 0, 0, 1, 0, 0, 0, 1, 0, -1, 0, 0, 0, 0, 0, 0, 0, 0, 1, 0, 1, 0, -1, 0, 0, 0, 0, 0, 0, -1, 0, -1, 1, 0, 0, 0, 0, 0, 0, 0, 1, 0, -1, 0, 0, 0, 0, 0, 0, 1, -1, 1, 0, -1, 0, 0, 1, -1, 0, 0, 0, 0, 1, 0};
+constexpr int b65[] = {0, 1, 0, 0, 0, 0, 0, 0, 0, 0, -1, 0, 1, 0, 0, 0, 0, 0, 0, -1, 0, -1, 0, -1, 0, 0, 0, 0, 0, 1, 0, 0, 1, 0, -1, 0, 0, 0, 0, 0, 0, 0, 0, 1, 0, 1, 0, 0, -1, 0, 0, 0, 0, 0, -1, 0, 1, -1, 1, 0, 0, 0, 0, 0, 0, -1, 0, 0, 0, 0, 0, 0, 0, 0, 0, 1, 0, 0, -1, 0, 0, 0, 0, 0, 1, -1, 0, 1, 0, -1, 0, 1, -1, 0, 0, 0, 0, 0, 1, 0};
+/* Line 451 */
+constexpr int a66[] = {0, 0, 0, -1, 1, 0, 0, 0, 0, 1, 0, -1, 0, 0, 0, -1, 0, 0, 1, -1, 1, 0, -1, 1, -1, 0, 0, 1, 0, 0, 0, 1, 0, -1, 0, 0};
+constexpr int b66[] = {0, -1, 0, 1, 0, 0, 1, 0, 1, -1, 0, 0, 0, -1, 0, 1, -1, 0, -1, 1, -1, 0, 1, -1, 0, 0, 1, -1, 0, 1, 0, 0, 0, 1, -1, 0};
+constexpr int conn66[] = {0, 4};
+constexpr Req reqs66[] = {Req::Line, Req::Line};
+constexpr int args66[] = {0, 0};
+constexpr int atob66[] = {0, -1, 0, 0, 0, 0, 1, 0, 1, 0, 0, 0, 0, -1, 0, 0, -1, 0, 0, 0, 0, 0, 0, 0, 0, 0, 1, 0, 0, 1, 0, 0, 0, 0, -1, 0};
+/* Line 458 */
+constexpr int a67[] = {0, 0, 0, 1, -1, 0, 0, 0, 0, -1, 0, 1, 0, 0, 0, 1, 0, 0, -1, 1, -1, 0, 1, -1, 1, 0, 0, -1, 0, 0, 0, -1, 0, 1, 0, 0};
+constexpr int b67[] = {0, 1, 0, -1, 0, 0, -1, 0, -1, 1, 0, 0, 0, 1, 0, -1, 1, 0, 1, -1, 1, 0, -1, 1, 0, 0, -1, 1, 0, -1, 0, 0, 0, -1, 1, 0};
+constexpr int conn67[] = {0, 4};
+constexpr Req reqs67[] = {Req::Line, Req::Line};
+constexpr int args67[] = {0, 0};
+constexpr int atob67[] = {0, 1, 0, 0, 0, 0, -1, 0, -1, 0, 0, 0, 0, 1, 0, 0, 1, 0, 0, 0, 0, 0, 0, 0, 0, 0, -1, 0, 0, -1, 0, 0, 0, 0, 1, 0};
+/* Line 465 */
+constexpr int a68[] = {0, -1, 0, 1, 0, 0, 1, 0, 1, -1, 0, 0, 0, -1, 0, 1, -1, 0, -1, 1, -1, 0, 1, -1, 0, 0, 1, -1, 0, 1, 0, 0, 0, 1, -1, 0};
+constexpr int b68[] = {0, -1, 0, 1, 0, 0, 1, 0, -1, 0, 0, 0, 0, 1, 0, -1, 1, 0, -1, 0, 1, 0, 0, -1, 0, 0, -1, 0, 0, 1, 0, 0, 0, 1, -1, 0};
+constexpr int conn68[] = {0, 4};
+constexpr Req reqs68[] = {Req::Line, Req::Line};
+constexpr int args68[] = {0, 0};
+constexpr int atob68[] = {0, -1, 0, 1, 0, 0, 1, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, -1, 0, 0, 0, 0, -1, 0, 0, 0, 0, 0, 1, 0, 0, 0, 1, -1, 0};
+constexpr int btoa68[] = {0, -1, 0, 1, 0, 0, 1, 0, 0, -1, 0, 0, 0, 0, 0, 0, 0, 0, -1, 1, 0, 0, 1, -1, 0, 0, 0, -1, 0, 1, 0, 0, 0, 1, -1, 0};
+/* Line 473 */
+constexpr int a69[] = {0, 1, 0, -1, 0, 0, -1, 0, -1, 1, 0, 0, 0, 1, 0, -1, 1, 0, 1, -1, 1, 0, -1, 1, 0, 0, -1, 1, 0, -1, 0, 0, 0, -1, 1, 0};
+constexpr int b69[] = {0, 1, 0, -1, 0, 0, -1, 0, 1, 0, 0, 0, 0, -1, 0, 1, -1, 0, 1, 0, -1, 0, 0, 1, 0, 0, 1, 0, 0, -1, 0, 0, 0, -1, 1, 0};
+constexpr int conn69[] = {0, 4};
+constexpr Req reqs69[] = {Req::Line, Req::Line};
+constexpr int args69[] = {0, 0};
+constexpr int atob69[] = {0, 1, 0, -1, 0, 0, -1, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 1, 0, 0, 0, 0, 1, 0, 0, 0, 0, 0, -1, 0, 0, 0, -1, 1, 0};
+constexpr int btoa69[] = {0, 1, 0, -1, 0, 0, -1, 0, 0, 1, 0, 0, 0, 0, 0, 0, 0, 0, 1, -1, 0, 0, -1, 1, 0, 0, 0, 1, 0, -1, 0, 0, 0, -1, 1, 0};
+/* Line 481 */
+constexpr int a70[] = {0, 1, -1, 0, 0, 0, 0, -1, 0, 1, -1, 0, 1, 0, 1, -1, 0, 1, 0, 0, 0, 0, 1, -1, 0, 1, -1, 0, 0, 0, 0, -1, 0, 1, 0, 0, -1, 0, 1, -1, 0, -1, 0, 0, 0, 0, 0, 1, 0};
+constexpr int b70[] = {0, -1, 0, 0, 0, 1, 0, 1, 0, -1, 1, 0, -1, 0, 0, 1, 0, 0, 0, 0, 0, 0, -1, 0, 0, 1, 0, 0, 0, 0, 0, -1, 0, 1, 0, -1, 1, 0, 0, -1, 0, -1, 0, 0, 0, 0, 0, 1, 0};
+constexpr int conn70[] = {0};
+constexpr Req reqs70[] = {Req::Line};
+constexpr int args70[] = {0};
+/* Line 486 */
+constexpr int a71[] = {0, -1, 1, 0, 0, 0, 0, 1, 0, -1, 1, 0, -1, 0, -1, 1, 0, -1, 0, 0, 0, 0, -1, 1, 0, -1, 1, 0, 0, 0, 0, 1, 0, -1, 0, 0, 1, 0, -1, 1, 0, 1, 0, 0, 0, 0, 0, -1, 0};
+constexpr int b71[] = {0, 1, 0, 0, 0, -1, 0, -1, 0, 1, -1, 0, 1, 0, 0, -1, 0, 0, 0, 0, 0, 0, 1, 0, 0, -1, 0, 0, 0, 0, 0, 1, 0, -1, 0, 1, -1, 0, 0, 1, 0, 1, 0, 0, 0, 0, 0, -1, 0};
+constexpr int conn71[] = {0};
+constexpr Req reqs71[] = {Req::Line};
+constexpr int args71[] = {0};
+/* Line 491 */
+constexpr int a72[] = {0, -1, 0, 0, 0, 1, 0, 1, 0, -1, 1, 0, -1, 0, 0, 1, 0, 0, 0, 0, 0, 0, -1, 0, 0, 1, 0, 0, 0, 0, 0, -1, 0, 1, 0, -1, 1, 0, 0, -1, 0, -1, 0, 0, 0, 0, 0, 1, 0};
+constexpr int b72[] = {0, 0, 0, 0, 0, -1, 0, 0, 0, -1, 1, -1, 1, -1, 0, 1, 0, 0, 0, 0, 0, 0, -1, 0, 0, 1, 0, 0, 0, 1, 0, -1, 0, -1, 0, 1, -1, 0, 0, 1, 0, 1, 0, 1, 0, 0, 0, -1, 0};
+constexpr int conn72[] = {0};
+constexpr Req reqs72[] = {Req::Line};
+constexpr int args72[] = {0};
+/* Line 496 */
+constexpr int a73[] = {0, 1, 0, 0, 0, -1, 0, -1, 0, 1, -1, 0, 1, 0, 0, -1, 0, 0, 0, 0, 0, 0, 1, 0, 0, -1, 0, 0, 0, 0, 0, 1, 0, -1, 0, 1, -1, 0, 0, 1, 0, 1, 0, 0, 0, 0, 0, -1, 0};
+constexpr int b73[] = {0, 0, 0, 0, 0, 1, 0, 0, 0, 1, -1, 1, -1, 1, 0, -1, 0, 0, 0, 0, 0, 0, 1, 0, 0, -1, 0, 0, 0, -1, 0, 1, 0, 1, 0, -1, 1, 0, 0, -1, 0, -1, 0, -1, 0, 0, 0, 1, 0};
+constexpr int conn73[] = {0};
+constexpr Req reqs73[] = {Req::Line};
+constexpr int args73[] = {0};
+/* Line 501 */
+constexpr int a74[] = {0, -1, 0, 1, 0, 0, 0, 0, -1, 0, 1, 0, 1, -1, 0, 0, 0, 0, 0, 0, 0, -1, 0, 1, -1, 0, 0, 0, 0, 0, -1, 1, -1, 0, 1, -1, 0, 0, 0, 0, 0, 0, 1, -1, 0, 0, 1, 0, 0, 0, 0, 0, 0, 1, 0, 0, -1, 0, 0, 0, 0, 0, 0, 0, -1, 1, 0, 1, 0, 0, 0, 0, 0, 0, 0, 0, -1, 0, 0, 1, 1, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, -1, 0, 0};
+constexpr int b74[] = {0, -1, 0, 1, 0, 0, 0, 0, -1, 0, 1, 0, 1, -1, 0, 0, 0, 0, 0, 0, 0, -1, 0, 1, -1, 0, 0, 0, 0, 0, -1, 1, -1, 0, 1, -1, 0, 0, 0, 0, 0, 0, 1, -1, 0, 1, -1, 1, 0, 0, 0, 0, 0, 1, -1, 0, 1, 0, 0, 0, 0, 0, 0, 0, 1, -1, 0, -1, 0, 0, 0, 0, 0, 0, -1, 0, 1, 0, 0, 1, 1, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, -1, 0, 0};
+/* Line 505 */
+constexpr int a75[] = {0, 1, 0, -1, 0, 0, 0, 0, 1, 0, -1, 0, -1, 1, 0, 0, 0, 0, 0, 0, 0, 1, 0, -1, 1, 0, 0, 0, 0, 0, 1, -1, 1, 0, -1, 1, 0, 0, 0, 0, 0, 0, -1, 1, 0, 0, -1, 0, 0, 0, 0, 0, 0, -1, 0, 0, 1, 0, 0, 0, 0, 0, 0, 0, 1, -1, 0, -1, 0, 0, 0, 0, 0, 0, 0, 0, 1, 0, 0, -1, -1, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 1, 0, 0};
+constexpr int b75[] = {0, 1, 0, -1, 0, 0, 0, 0, 1, 0, -1, 0, -1, 1, 0, 0, 0, 0, 0, 0, 0, 1, 0, -1, 1, 0, 0, 0, 0, 0, 1, -1, 1, 0, -1, 1, 0, 0, 0, 0, 0, 0, -1, 1, 0, -1, 1, -1, 0, 0, 0, 0, 0, -1, 1, 0, -1, 0, 0, 0, 0, 0, 0, 0, -1, 1, 0, 1, 0, 0, 0, 0, 0, 0, 1, 0, -1, 0, 0, -1, -1, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 1, 0, 0};
+/* Line 509 */
+constexpr int a76[] = {0, -1, 0, 1, 0, 0, 0, 0, -1, 0, 1, 0, 1, -1, 0, 0, 0, 0, 0, 0, 0, -1, 0, 1, -1, 0, 0, 0, 0, 0, -1, 1, -1, 0, 1, -1, 0, 0, 0, 0, 0, 0, 1, -1, 0, 1, -1, 1, 0, 0, 0, 0, 0, 1, -1, 0, 1, 0, 0, 0, 0, 0, 0, 0, 1, -1, 0, -1, 0, 0, 0, 0, 0, 0, -1, 0, 1, 0, 0, 1, 1, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, -1, 0, 0};
+constexpr int b76[] = {0, -1, 0, 1, 0, 0, 0, 0, -1, 0, 1, 0, 1, -1, 0, 0, 0, 0, 0, 0, 0, -1, 0, 0, 1, 0, -1, 0, 0, 0, -1, 1, 0, 0, -1, 0, 0, 1, 0, 0, 0, 0, -1, 1, 0, -1, 1, -1, 0, 0, 0, 0, 0, 0, 1, 0, 0, 0, 0, 0, 0, 0, 1, 0, -1, 0, 0, 0, 0, 0, 0, 0, 0, -1, 1, 0, 0, 0, 0, 1, 1, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, -1, 0, 0};
+}
+constexpr MoveRecord MOVE_TABLE[] = {
+    {{3, 3, a0}, {3, 3, b0}, 2, conn0, reqs0, args0, {0, 0, nullptr}, {0, 0, nullptr}},
+    {{3, 3, a1}, {3, 3, b1}, 2, conn1, reqs1, args1, {0, 0, nullptr}, {0, 0, nullptr}},
+    {{4, 4, a2}, {4, 4, b2}, 3, conn2, reqs2, args2, {0, 0, nullptr}, {0, 0, nullptr}},
+    {{4, 4, a3}, {4, 4, b3}, 3, conn3, reqs3, args3, {0, 0, nullptr}, {0, 0, nullptr}},
+    {{5, 5, a4}, {5, 5, b4}, 1, conn4, reqs4, args4, {0, 0, nullptr}, {0, 0, nullptr}},
+    {{5, 5, a5}, {5, 5, b5}, 2, conn5, reqs5, args5, {0, 0, nullptr}, {0, 0, nullptr}},
+    {{5, 5, a6}, {5, 5, b6}, 2, conn6, reqs6, args6, {0, 0, nullptr}, {0, 0, nullptr}},
+    {{6, 6, a7}, {6, 6, b7}, 0, nullptr, nullptr, nullptr, {0, 0, nullptr}, {0, 0, nullptr}},
+    {{6, 6, a8}, {6, 6, b8}, 0, nullptr, nullptr, nullptr, {0, 0, nullptr}, {0, 0, nullptr}},
+    {{4, 4, a9}, {4, 4, b9}, 1, conn9, reqs9, args9, {0, 0, nullptr}, {0, 0, nullptr}},
+    {{4, 4, a10}, {4, 4, b10}, 1, conn10, reqs10, args10, {0, 0, nullptr}, {0, 0, nullptr}},
+    {{4, 4, a11}, {4, 4, b11}, 3, conn11, reqs11, args11, {0, 0, nullptr}, {0, 0, nullptr}},
+    {{4, 4, a12}, {4, 4, b12}, 3, conn12, reqs12, args12, {0, 0, nullptr}, {0, 0, nullptr}},
+    {{5, 5, a13}, {5, 5, b13}, 3, conn13, reqs13, args13, {0, 0, nullptr}, {0, 0, nullptr}},
+    {{5, 5, a14}, {5, 5, b14}, 3, conn14, reqs14, args14, {0, 0, nullptr}, {0, 0, nullptr}},
+    {{6, 6, a15}, {6, 6, b15}, 1, conn15, reqs15, args15, {0, 0, nullptr}, {0, 0, nullptr}},
+    {{6, 6, a16}, {6, 6, b16}, 1, conn16, reqs16, args16, {0, 0, nullptr}, {0, 0, nullptr}},
+    {{5, 5, a17}, {5, 5, b17}, 3, conn17, reqs17, args17, {0, 0, nullptr}, {0, 0, nullptr}},
+    {{4, 4, a18}, {4, 4, b18}, 3, conn18, reqs18, args18, {0, 0, nullptr}, {0, 0, nullptr}},
+    {{4, 4, a19}, {4, 4, b19}, 3, conn19, reqs19, args19, {0, 0, nullptr}, {0, 0, nullptr}},
+    {{6, 6, a20}, {6, 6, b20}, 3, conn20, reqs20, args20, {0, 0, nullptr}, {0, 0, nullptr}},
+    {{6, 6, a21}, {6, 6, b21}, 3, conn21, reqs21, args21, {0, 0, nullptr}, {0, 0, nullptr}},
+    {{5, 5, a22}, {5, 5, b22}, 4, conn22, reqs22, args22, {0, 0, nullptr}, {0, 0, nullptr}},
+    {{8, 8, a23}, {8, 8, b23}, 0, nullptr, nullptr, nullptr, {0, 0, nullptr}, {0, 0, nullptr}},
+    {{8, 8, a24}, {8, 8, b24}, 0, nullptr, nullptr, nullptr, {0, 0, nullptr}, {0, 0, nullptr}},
+    {{6, 6, a25}, {6, 6, b25}, 3, conn25, reqs25, args25, {0, 0, nullptr}, {0, 0, nullptr}},
+    {{5, 5, a26}, {5, 5, b26}, 2, conn26, reqs26, args26, {0, 0, nullptr}, {0, 0, nullptr}},
+    {{5, 5, a27}, {5, 5, b27}, 2, conn27, reqs27, args27, {0, 0, nullptr}, {0, 0, nullptr}},
+    {{4, 4, a28}, {4, 4, b28}, 2, conn28, reqs28, args28, {0, 0, nullptr}, {0, 0, nullptr}},
+    {{6, 6, a29}, {6, 6, b29}, 3, conn29, reqs29, args29, {0, 0, nullptr}, {0, 0, nullptr}},
+    {{6, 6, a30}, {6, 6, b30}, 3, conn30, reqs30, args30, {0, 0, nullptr}, {0, 0, nullptr}},
+    {{6, 6, a31}, {6, 6, b31}, 2, conn31, reqs31, args31, {0, 0, nullptr}, {0, 0, nullptr}},
+    {{6, 6, a32}, {6, 6, b32}, 2, conn32, reqs32, args32, {0, 0, nullptr}, {0, 0, nullptr}},
+    {{6, 6, a33}, {6, 6, b33}, 2, conn33, reqs33, args33, {0, 0, nullptr}, {0, 0, nullptr}},
+    {{7, 7, a34}, {7, 7, b34}, 2, conn34, reqs34, args34, {0, 0, nullptr}, {0, 0, nullptr}},
+    {{7, 7, a35}, {7, 7, b35}, 2, conn35, reqs35, args35, {0, 0, nullptr}, {0, 0, nullptr}},
+    {{6, 6, a36}, {6, 6, b36}, 2, conn36, reqs36, args36, {0, 0, nullptr}, {0, 0, nullptr}},
+    {{6, 6, a37}, {6, 6, b37}, 2, conn37, reqs37, args37, {0, 0, nullptr}, {0, 0, nullptr}},
+    {{6, 6, a38}, {6, 6, b38}, 2, conn38, reqs38, args38, {0, 0, nullptr}, {0, 0, nullptr}},
+    {{6, 6, a39}, {6, 6, b39}, 2, conn39, reqs39, args39, {0, 0, nullptr}, {0, 0, nullptr}},
+    {{7, 7, a40}, {7, 7, b40}, 2, conn40, reqs40, args40, {0, 0, nullptr}, {0, 0, nullptr}},
+    {{7, 7, a41}, {7, 7, b41}, 2, conn41, reqs41, args41, {0, 0, nullptr}, {0, 0, nullptr}},
+    {{8, 8, a42}, {8, 8, b42}, 2, conn42, reqs42, args42, {0, 0, nullptr}, {0, 0, nullptr}},
+    {{6, 6, a43}, {6, 6, b43}, 3, conn43, reqs43, args43, {0, 0, nullptr}, {0, 0, nullptr}},
+    {{9, 9, a44}, {9, 9, b44}, 0, nullptr, nullptr, nullptr, {0, 0, nullptr}, {0, 0, nullptr}},
+    {{3, 3, a45}, {3, 3, b45}, 2, conn45, reqs45, args45, {3, 3, atob45}, {3, 3, btoa45}},
+    {{3, 3, a46}, {3, 3, b46}, 2, conn46, reqs46, args46, {3, 3, atob46}, {3, 3, btoa46}},
+    {{5, 5, a47}, {5, 5, b47}, 2, conn47, reqs47, args47, {5, 5, atob47}, {0, 0, nullptr}},
+    {{5, 5, a48}, {5, 5, b48}, 2, conn48, reqs48, args48, {5, 5, atob48}, {0, 0, nullptr}},
+    {{8, 8, a49}, {8, 8, b49}, 3, conn49, reqs49, args49, {8, 8, atob49}, {0, 0, nullptr}},
+    {{8, 8, a50}, {8, 8, b50}, 3, conn50, reqs50, args50, {8, 8, atob50}, {0, 0, nullptr}},
+    {{7, 7, a51}, {7, 7, b51}, 1, conn51, reqs51, args51, {0, 0, nullptr}, {0, 0, nullptr}},
+    {{8, 8, a52}, {8, 8, b52}, 1, conn52, reqs52, args52, {0, 0, nullptr}, {0, 0, nullptr}},
+    {{8, 8, a53}, {8, 8, b53}, 1, conn53, reqs53, args53, {0, 0, nullptr}, {0, 0, nullptr}},
+    {{6, 6, a54}, {6, 6, b54}, 3, conn54, reqs54, args54, {6, 6, atob54}, {6, 6, btoa54}},
+    {{6, 6, a55}, {6, 6, b55}, 3, conn55, reqs55, args55, {6, 6, atob55}, {6, 6, btoa55}},
+    {{6, 6, a56}, {6, 6, b56}, 3, conn56, reqs56, args56, {6, 6, atob56}, {0, 0, nullptr}},
+    {{6, 6, a57}, {6, 6, b57}, 3, conn57, reqs57, args57, {6, 6, atob57}, {0, 0, nullptr}},
+    {{5, 5, a58}, {5, 5, b58}, 3, conn58, reqs58, args58, {5, 5, atob58}, {5, 5, btoa58}},
+    {{5, 5, a59}, {5, 5, b59}, 3, conn59, reqs59, args59, {5, 5, atob59}, {5, 5, btoa59}},
+    {{8, 8, a60}, {8, 8, b60}, 2, conn60, reqs60, args60, {8, 8, atob60}, {8, 8, btoa60}},
+    {{8, 8, a61}, {8, 8, b61}, 2, conn61, reqs61, args61, {8, 8, atob61}, {8, 8, btoa61}},
+    {{6, 6, a62}, {6, 6, b62}, 4, conn62, reqs62, args62, {6, 6, atob62}, {0, 0, nullptr}},
+    {{6, 6, a63}, {6, 6, b63}, 4, conn63, reqs63, args63, {6, 6, atob63}, {0, 0, nullptr}},
+    {{10, 10, a64}, {10, 10, b64}, 0, nullptr, nullptr, nullptr, {0, 0, nullptr}, {0, 0, nullptr}},
+    {{10, 10, a65}, {10, 10, b65}, 0, nullptr, nullptr, nullptr, {0, 0, nullptr}, {0, 0, nullptr}},
+    {{6, 6, a66}, {6, 6, b66}, 2, conn66, reqs66, args66, {6, 6, atob66}, {0, 0, nullptr}},
+    {{6, 6, a67}, {6, 6, b67}, 2, conn67, reqs67, args67, {6, 6, atob67}, {0, 0, nullptr}},
+    {{6, 6, a68}, {6, 6, b68}, 2, conn68, reqs68, args68, {6, 6, atob68}, {6, 6, btoa68}},
+    {{6, 6, a69}, {6, 6, b69}, 2, conn69, reqs69, args69, {6, 6, atob69}, {6, 6, btoa69}},
+    {{7, 7, a70}, {7, 7, b70}, 1, conn70, reqs70, args70, {0, 0, nullptr}, {0, 0, nullptr}},
+    {{7, 7, a71}, {7, 7, b71}, 1, conn71, reqs71, args71, {0, 0, nullptr}, {0, 0, nullptr}},
+    {{7, 7, a72}, {7, 7, b72}, 1, conn72, reqs72, args72, {0, 0, nullptr}, {0, 0, nullptr}},
+    {{7, 7, a73}, {7, 7, b73}, 1, conn73, reqs73, args73, {0, 0, nullptr}, {0, 0, nullptr}},
+    {{10, 10, a74}, {10, 10, b74}, 0, nullptr, nullptr, nullptr, {0, 0, nullptr}, {0, 0, nullptr}},
+    {{10, 10, a75}, {10, 10, b75}, 0, nullptr, nullptr, nullptr, {0, 0, nullptr}, {0, 0, nullptr}},
+    {{10, 10, a76}, {10, 10, b76}, 0, nullptr, nullptr, nullptr, {0, 0, nullptr}, {0, 0, nullptr}},
+};
+constexpr size_t MOVE_TABLE_SIZE = 77;
+}
+}
@@ -0,0 +1,189 @@
+/*
+ * move_text.cc
+ * Copyright 2014-2015 John Lawson
+ *
+ * This program is free software: you can redistribute it and/or modify
+ * it under the terms of the GNU General Public License as published by
+ * the Free Software Foundation, either version 3 of the License, or
+ * (at your option) any later version.
+ *
+ * This program is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ * GNU General Public License for more details.
+ *
+ * You should have received a copy of the GNU General Public License
+ * along with this program.  If not, see <http://www.gnu.org/licenses/>.
+ */
+#include "move_table.h"
+
+#include <sstream>
+#include <stdexcept>
+
+namespace qvdraw {
+namespace consts {
+namespace {
+MatrixRecord record_of(const MoveDefinition::Matrix& matrix) {
+  return {matrix.rows, matrix.cols, matrix.entries.data()};
+}
+bool valid_vertex(const MoveDefinition::Matrix& matrix, int v) {
+  return v >= 0 && v < matrix.rows;
+}
+}
+MoveRecord MoveDefinition::record() const {
+  return {record_of(a),    record_of(b),   conn.size(),
+          conn.data(),     reqs.data(),    req_args.data(),
+          record_of(atob), record_of(btoa)};
+}
+MoveDefinition::Matrix parse_matrix(const std::string& str) {
+  MoveDefinition::Matrix result;
+  std::istringstream in(str);
+  std::string token;
+  int depth = 0;
+  int cols = 0;
+  bool closed = false;
+  while (in >> token) {
+    if (closed) {
+      throw std::invalid_argument("Trailing text after matrix: " + str);
+    }
+    if (token == "{") {
+      if (++depth > 2) {
+        throw std::invalid_argument("Too many braces in matrix: " + str);
+      }
+      cols = 0;
+    } else if (token == "}") {
+      if (depth == 2) {
+        if (result.rows == 0) {
+          result.cols = cols;
+        } else if (cols != result.cols) {
+          throw std::invalid_argument("Rows of different lengths: " + str);
+        }
+        ++result.rows;
+      } else if (depth == 1) {
+        closed = true;
+      } else {
+        throw std::invalid_argument("Unbalanced braces in matrix: " + str);
+      }
+      --depth;
+    } else if (depth == 2) {
+      size_t used;
+      int value;
+      try {
+        value = std::stoi(token, &used);
+      } catch (const std::logic_error&) {
+        used = 0;
+      }
+      if (used != token.size()) {
+        throw std::invalid_argument("Bad entry " + token + " in matrix");
+      }
+      result.entries.push_back(value);
+      ++cols;
+    } else {
+      throw std::invalid_argument("Entry outside a row of matrix: " + str);
+    }
+  }
+  if (!closed) {
+    throw std::invalid_argument("Unterminated matrix: " + str);
+  }
+  return result;
+}
+std::vector<MoveDefinition> read_moves(std::istream& is) {
+  std::vector<MoveDefinition> result;
+  std::string line;
+  size_t number = 0;
+  auto fail = [&number](const std::string& why) {
+    return std::runtime_error("Line " + std::to_string(number) + ": " + why);
+  };
+  auto check = [&](const MoveDefinition& move) {
+    if (move.a.rows == 0 || move.b.rows == 0) {
+      number = move.line;
+      throw fail("move needs both quivers a and b");
+    }
+    if (move.a.rows != move.b.rows || move.a.rows != move.a.cols ||
+        move.b.rows != move.b.cols) {
+      number = move.line;
+      throw fail("quivers a and b must be square and the same size");
+    }
+    for (const MoveDefinition::Matrix* finite : {&move.atob, &move.btoa}) {
+      if (finite->rows != 0 &&
+          (finite->rows != move.a.rows || finite->cols != move.a.cols)) {
+        number = move.line;
+        throw fail("finite quivers must be the same size as the move");
+      }
+    }
+    for (size_t i = 0; i < move.conn.size(); ++i) {
+      bool other = move.reqs[i] == Req::ConnectedTo ||
+                   move.reqs[i] == Req::LineTo;
+      if (!valid_vertex(move.a, move.conn[i]) ||
+          (other && !valid_vertex(move.a, move.req_args[i]))) {
+        number = move.line;
+        throw fail("connection to a vertex outside the move");
+      }
+    }
+  };
+  while (std::getline(is, line)) {
+    ++number;
+    line = line.substr(0, line.find('#'));
+    std::istringstream in(line);
+    std::string key;
+    if (!(in >> key)) {
+      continue;
+    }
+    if (key == "move") {
+      if (!result.empty()) {
+        check(result.back());
+      }
+      result.emplace_back();
+      result.back().line = number;
+      continue;
+    }
+    if (result.empty()) {
+      throw fail("expected 'move' before " + key);
+    }
+    MoveDefinition& move = result.back();
+    std::string rest;
+    std::getline(in, rest);
+    try {
+      if (key == "a") {
+        move.a = parse_matrix(rest);
+      } else if (key == "b") {
+        move.b = parse_matrix(rest);
+      } else if (key == "atob") {
+        move.atob = parse_matrix(rest);
+      } else if (key == "btoa") {
+        move.btoa = parse_matrix(rest);
+      } else if (key == "conn") {
+        std::istringstream args(rest);
+        int vertex;
+        std::string req;
+        int other = 0;
+        if (!(args >> vertex >> req)) {
+          throw fail("expected 'conn vertex requirement'");
+        }
+        if (req == "unconnected") {
+          move.reqs.push_back(Req::Unconnected);
+        } else if (req == "line") {
+          move.reqs.push_back(Req::Line);
+        } else if (req == "connected" && args >> other) {
+          move.reqs.push_back(Req::ConnectedTo);
+        } else if (req == "lineto" && args >> other) {
+          move.reqs.push_back(Req::LineTo);
+        } else {
+          throw fail("unknown requirement " + req);
+        }
+        move.conn.push_back(vertex);
+        move.req_args.push_back(other);
+      } else {
+        throw fail("unknown key " + key);
+      }
+    } catch (const std::invalid_argument& e) {
+      throw fail(e.what());
+    }
+  }
+  if (!result.empty()) {
+    check(result.back());
+  }
+  return result;
+}
+}
+}
@@ -25,10 +25,13 @@
 #include "qv/dynkin.h"
 #include "qv/quiver_matrix.h"
 
-#include "graph_factory.h"
+#include "gml.h"
+#include "qvb.h"
+#include "trace.h"
 
 void usage() {
-	std::cout << "qv2gml [-d dynkin | -m matrix]" << std::endl;
+	std::cout << "qv2gml [-t format] [-d dynkin | -m matrix]" << std::endl;
+	std::cout << "  -t Output format, one of gml, graphml or qvb" << std::endl;
 }
 
 bool valid_dynkin(std::string matrix) {
@@ -42,17 +45,25 @@ cluster::QuiverMatrix get_matrix(bool dynkin, const std::string& matrix) {
 	return cluster::QuiverMatrix(matrix);
 }
 
-void output_gml(const cluster::QuiverMatrix& mat) {
-	qvdraw::graph_factory::graph(mat).second->writeGML(std::cout);
+void output_gml(const cluster::QuiverMatrix& mat, const std::string& format) {
+	if(format == "qvb") {
+		qvdraw::qvb::quiver(mat).write(std::cout);
+		return;
+	}
+	qvdraw::gml::write(std::cout, mat,
+			format == "graphml" ? qvdraw::gml::Format::GraphML
+			: qvdraw::gml::Format::GML);
 }
 
 int main(int argc, char* argv[]) {
+	qvdraw::trace::init(argc, argv);
 	bool dynkin = false;
 	bool matrix = false;
+	std::string format = "gml";
 	std::string str;
 	int c;
 
-	while( (c=getopt(argc, argv, "m:d:")) != -1) {
+	while( (c=getopt(argc, argv, "m:d:t:")) != -1) {
 		switch(c) {
 			case 'm':
 				matrix = true;
@@ -62,6 +73,9 @@ int main(int argc, char* argv[]) {
 				dynkin = true;
 				str = optarg;
 				break;
+			case 't':
+				format = optarg;
+				break;
 			case '?':
 				usage();
 				return 1;
@@ -74,13 +88,13 @@ int main(int argc, char* argv[]) {
 		std::cout << "Unrecognized matrix" << std::endl;
 		return 1;
 	}
-	if(!matrix && !dynkin) {
+	if((!matrix && !dynkin) || (format != "gml" && format != "graphml" && format != "qvb")) {
 		usage();
 		return 1;
 	}
 	typedef cluster::QuiverMatrix Matrix;
 	Matrix mat = get_matrix(dynkin, str);
-	output_gml(mat);
+	output_gml(mat, format);
 	return 0;
 }
 
@@ -18,8 +18,19 @@
 /**
  * Convert quivers and graphs into TeX documents - using the Tikz package.
  */
+#include <atomic>
+#include <chrono>
+#include <deque>
+#include <numeric>
 #include <ostream>
+#include <sstream>
+#include <stdexcept>
+#include <string>
+#include <type_traits>
+#include <getopt.h>
+#include <mutex>
 #include <unistd.h>
+#include <unordered_map>
 
 #include "ogdf/basic/Graph.h"
 #include "ogdf/basic/GraphAttributes.h"
@@ -27,14 +38,25 @@
 #include "qv/template_exchange_graph.h"
 #include "qv/ginac_util.h"
 #include "qv/green_exchange_graph.h"
-#include "qv/move_graph.h"
 
 #include "qvrefl/compatible_cartan_iterator.h"
 #include "qvrefl/util.h"
 
+#include "checkpoint.h"
 #include "consts.h"
+#include "csr_graph.h"
+#include "explore.h"
 #include "graph_factory.h"
+#include "gvector_seed.h"
+#include "incremental.h"
 #include "layout.h"
+#include "layout_cache.h"
+#include "move_index.h"
+#include "parallel.h"
+#include "parallel_explore.h"
+#include "qvb.h"
+#include "tex.h"
+#include "trace.h"
 
 namespace {
 cluster::Seed::Cluster default_cluster(size_t size) {
@@ -64,69 +86,69 @@ void begin(std::ostream& os) {
 void end(std::ostream& os) {
   os << "\\end{document}%" << os.widen('\n');
 }
-void draw_quiver(std::ostream& os,
+void draw_quiver(TexBuffer& out,
                  const ogdf::Graph& graph,
                  const ogdf::GraphAttributes& attr,
                  const char* color = "black") {
   ogdf::node n;
-  os << "\\begin{tikzpicture}[x=\\qvsize,y=\\qvsize]" << os.widen('\n');
+  out << "\\begin{tikzpicture}[x=\\qvsize,y=\\qvsize]\n";
   forall_nodes(n, graph) {
-    os << "\\tkzDefPoint(" << attr.x(n) << "," << attr.y(n) << "){n";
-    os << n->index() << "}%" << os.widen('\n');
+    out << "\\tkzDefPoint(" << attr.x(n) << ',' << attr.y(n) << "){n";
+    out << n->index() << "}%\n";
   }
   ogdf::edge e;
   forall_edges(e, graph) {
-    os << "\\draw[->,shorten <=5,shorten >=5," << color << "] (n"
-       << e->source()->index() << ") -- (n";
-    os << e->target()->index() << ")";
+    out << "\\draw[->,shorten <=5,shorten >=5," << color << "] (n"
+        << e->source()->index() << ") -- (n";
+    out << e->target()->index() << ')';
     if (attr.labelEdge(e).length() > 0) {
-      os << "node[midway,above,sloped] {$" << attr.labelEdge(e) << "$}";
+      out << "node[midway,above,sloped] {$" << attr.labelEdge(e) << "$}";
     }
-    os << ";" << os.widen('\n');
+    out << ";\n";
   }
-  os << "\\tkzDrawPoints[color=" << color << "](";
+  out << "\\tkzDrawPoints[color=" << color << "](";
   forall_nodes(n, graph) {
-    os << "n" << n->index();
+    out << 'n' << n->index();
     if (n->succ()) {
-      os << ",";
+      out << ',';
     }
   }
-  os << ");" << os.widen('\n');
+  out << ");\n";
   forall_nodes(n, graph) {
     if (attr.labelNode(n).length() > 0) {
-      os << "\\tkzLabelPoint[color=" << color << "](n" << n->index() << "){$"
-         << attr.labelNode(n);
-      os << "$}%" << os.widen('\n');
+      out << "\\tkzLabelPoint[color=" << color << "](n" << n->index() << "){$"
+          << attr.labelNode(n);
+      out << "$}%\n";
     }
   }
-  os << "\\draw[" << color << "](current bounding box.south west)rectangle"
-                              "(current bounding box.north east);"
-     << os.widen('\n');
-  os << "\\end{tikzpicture}%" << os.widen('\n');
+  out << "\\draw[" << color << "](current bounding box.south west)rectangle"
+                               "(current bounding box.north east);\n";
+  out << "\\end{tikzpicture}%\n";
 }
-void box_quiver(std::ostream& os,
+void box_quiver(TexBuffer& out,
                 const std::string& name,
                 const ogdf::Graph& graph,
                 const ogdf::GraphAttributes& attr,
                 const char* color = "black") {
-  os << "\\newsavebox{\\" << name << "}%" << os.widen('\n');
-  os << "\\sbox{\\" << name << "}{%" << os.widen('\n');
-  os << "\\scalebox{\\qvscale}{%" << os.widen('\n');
-  draw_quiver(os, graph, attr, color);
-  os << "}}%" << os.widen('\n');
+  out << "\\newsavebox{\\" << name << "}%\n";
+  out << "\\sbox{\\" << name << "}{%\n";
+  out << "\\scalebox{\\qvscale}{%\n";
+  draw_quiver(out, graph, attr, color);
+  out << "}}%\n";
 }
 namespace colouring {
 template <class Seed>
 struct GreenSeqExistence {
   const char* vertex_colour(Seed const* vertex) const {
-    if (chk(vertex, 0)) {
+    if (qvdraw::explore::may_be_green(chk, *vertex, 0)) {
       return "blue";
     } else {
       return "red";
     }
   }
   const char* edge_colour(Seed const* source, Seed const* dest) const {
-    if (chk(source, 0) && chk(dest, 0)) {
+    if (qvdraw::explore::may_be_green(chk, *source, 0) &&
+        qvdraw::explore::may_be_green(chk, *dest, 0)) {
       return "blue";
     } else {
       return "red";
@@ -171,131 +193,473 @@ struct NonCompatibleLabel {
   bool has_label(Quiver const* quiv) const { return !(quiv->fully_compatible); }
   /* This is a bit of a hack to ensure that the labels are pritned out. I would
    * prefer it if the ostream could be specified, and if the outputting was more
-   * explicitly done. */
-  const char* label(Quiver const* quiv) {
+   * explicitly done.
+   *
+   * Each label is built up and written to stderr in one go, and the counter is
+   * atomic, so that labels can be taken from more than one thread. */
+  std::string label(Quiver const* quiv) {
     if (quiv->fully_compatible) {
       return "";
     }
-    if (count == 0) {
-      std::cerr << "Found non fully compatible cartans:"
-                << std::cerr.widen('\n');
+    int number = count++;
+    std::ostringstream ss;
+    if (number == 0) {
+      ss << "Found non fully compatible cartans:" << ss.widen('\n');
     }
-    std::cerr << count << ": " << quiv->quiver << std::cerr.widen('\n');
-    return std::to_string(count++).c_str();
+    ss << number << ": " << quiv->quiver << ss.widen('\n');
+    std::cerr << ss.str();
+    return std::to_string(number);
   }
 
  private:
-  int count = 0;
+  std::atomic<int> count{0};
 };
 }
-std::string int_to_str(int a) {
-  char lookup[] = {'a', 'b', 'c', 'd', 'e', 'f', 'g', 'k', 'i', 'j'};
-  std::string result;
-  if (a == 0) {
-    result += lookup[0];
+/* Options controlling how the multi-graphs are explored and drawn. */
+struct DrawOptions {
+  /* Cache of quiver layouts shared between runs, if any. */
+  qvlayout::LayoutCache* cache = nullptr;
+  /* Number of threads used to lay out the vertex quivers. */
+  size_t jobs = 1;
+  /* Start each vertex quiver layout from the layout of its parent in a
+   * breadth first search from the initial quiver. */
+  bool warm_start = false;
+  /* Save one box for each distinct vertex drawing, rather than one for every
+   * vertex, and draw the edges of each colour as a single path. */
+  bool glyphs = false;
+  /* File to save the laid out graph to in the binary format, if any. */
+  std::string binary;
+  /* File to save the state of the exploration to every checkpoint_interval,
+   * and whether to carry on from the state already saved there. */
+  std::string checkpoint;
+  std::chrono::seconds checkpoint_interval{300};
+  bool resume = false;
+  /* Options of the graph recorded in the checkpoint. */
+  qvdraw::explore::Flags checkpoint_flags;
+  /* Choose the quality of the whole graph layout from its size, refining it
+   * for up to layout_budget seconds if that is positive. */
+  bool auto_layout = false;
+  double layout_budget = 0;
+  /* Earlier layout of part of the graph to keep, in GML or binary format, and
+   * whether to relax the whole graph after placing the new vertices. */
+  std::string previous;
+  bool relax_previous = false;
+};
+/* The matrix of the quiver drawn at each vertex of a multi-graph. */
+const cluster::IntMatrix& quiver_of(const cluster::IntMatrix& matrix) {
+  return matrix;
+}
+template <class M>
+const cluster::IntMatrix& quiver_of(const cluster::__Seed<M>& seed) {
+  return seed.matrix();
+}
+const cluster::IntMatrix& quiver_of(
+    const refl::cartan_exchange::CartanQuiver& quiver) {
+  return quiver.quiver;
+}
+const cluster::IntMatrix& quiver_of(const qvdraw::GVectorSeed& seed) {
+  return seed.matrix();
+}
+/*
+ * Whether vertex i of the quiver at each vertex of the graph is vertex i of
+ * the quivers next to it, so that one layout can start from another. This only
+ * holds in labelled graphs, as otherwise each quiver is kept with whichever
+ * order of vertices it was first found with.
+ */
+template <class M>
+bool same_vertices(const M&) {
+  return false;
+}
+bool same_vertices(const cluster::QuiverMatrix&) { return true; }
+bool same_vertices(const cluster::LabelledSeed&) { return true; }
+bool same_vertices(const qvdraw::GVectorSeed& seed) { return seed.labelled(); }
+/*
+ * Lay out the graph joining the vertices, reporting the settings chosen by
+ * the automatic layout. If there is an earlier layout then the vertices are
+ * matched to it by their quivers and only the new ones are placed, which is
+ * only done for graphs whose vertices are distinct quivers.
+ */
+template <class M>
+void layout_graph(ogdf::Graph& graph, ogdf::GraphAttributes& attr,
+                  const std::vector<const M*>& table,
+                  const DrawOptions& opts) {
+  if (!opts.previous.empty()) {
+    std::vector<std::string> keys;
+    keys.reserve(table.size());
+    for (const M* vertex : table) {
+      std::ostringstream key;
+      if (vertex != nullptr) {
+        key << quiver_of(*vertex);
+      }
+      keys.push_back(key.str());
+    }
+    std::vector<bool> known = qvlayout::place_known(
+        qvlayout::read_previous(opts.previous), keys, graph, attr);
+    std::cerr << qvlayout::extend(graph, attr, known, 10, !opts.relax_previous)
+              << std::cerr.widen('\n');
+  } else if (opts.auto_layout) {
+    std::cerr << qvlayout::layout_auto(graph, attr, 10, opts.layout_budget)
+              << std::cerr.widen('\n');
+  } else {
+    qvlayout::layout(graph, attr, 10, qvlayout::Method::Energy);
   }
-  while (a > 0) {
-    result += lookup[a % 10];
-    a = a / 10;
+}
+/*
+ * Split the vertices into the levels of a breadth first search from the root,
+ * storing the index of the parent of each vertex. Vertices which cannot be
+ * reached from the root are searched from in turn, and have no parent.
+ */
+const size_t NO_PARENT = SIZE_MAX;
+std::vector<std::vector<size_t>> bfs_levels(
+    const ogdf::Graph& graph,
+    const std::vector<ogdf::node>& vertices,
+    size_t root,
+    std::vector<size_t>& parent) {
+  ogdf::NodeArray<int> index(graph, -1);
+  for (size_t i = 0; i < vertices.size(); ++i) {
+    index[vertices[i]] = i;
   }
-  return result;
+  std::vector<std::vector<size_t>> levels;
+  std::vector<bool> seen(vertices.size(), false);
+  parent.assign(vertices.size(), NO_PARENT);
+  for (size_t start = 0; start < vertices.size(); ++start) {
+    size_t first = start == 0 ? root : start;
+    if (seen[first]) {
+      continue;
+    }
+    seen[first] = true;
+    std::vector<size_t> level{first};
+    while (!level.empty()) {
+      std::vector<size_t> next;
+      for (size_t v : level) {
+        ogdf::adjEntry adj;
+        forall_adj(adj, vertices[v]) {
+          int w = index[adj->twinNode()];
+          if (w >= 0 && !seen[w]) {
+            seen[w] = true;
+            parent[w] = v;
+            next.push_back(w);
+          }
+        }
+      }
+      levels.push_back(std::move(level));
+      level = std::move(next);
+    }
+  }
+  return levels;
+}
+/* Save the laid out graph, with the quiver of each vertex, if asked to. */
+template <class M>
+void save_binary(const DrawOptions& opts,
+                 const std::vector<const M*>& table,
+                 const ogdf::Graph& graph,
+                 const ogdf::GraphAttributes& attr) {
+  if (opts.binary.empty()) {
+    return;
+  }
+  std::vector<const cluster::IntMatrix*> quivers(table.size(), nullptr);
+  for (size_t i = 0; i < table.size(); ++i) {
+    if (table[i] != nullptr) {
+      quivers[i] = &quiver_of(*table[i]);
+    }
+  }
+  qvdraw::graph_factory::binary(graph, attr, &quivers).write(opts.binary);
 }
 template <class M, class Colour, class Label = vertex_label::NoLabel>
 void draw_multi_graph(std::ostream& os,
-                      const qvdraw::NodeMap<M>& map,
+                      const std::vector<const M*>& table,
                       const ogdf::Graph& graph,
-                      const ogdf::GraphAttributes& attr) {
-  static Colour colouring;
-  static Label labelling;
+                      const ogdf::GraphAttributes& attr,
+                      const M& initial,
+                      const DrawOptions& opts) {
+  const Colour colouring{};
+  Label labelling;
+  /* Most vertices are the same quiver up to relabelling, so lay out each
+   * equivalence class once and permute that layout for the other vertices. */
+  qvlayout::LayoutCache classes;
+  qvlayout::LayoutCache* cache = opts.cache != nullptr ? opts.cache : &classes;
+  typedef std::pair<std::shared_ptr<ogdf::Graph>,
+                    std::shared_ptr<ogdf::GraphAttributes>>
+      Picture;
   ogdf::node node;
-  std::vector<ogdf::node> nodes_to_remove;
+  std::vector<ogdf::node> vertices;
+  std::vector<const M*> quivers;
+  std::vector<const char*> colours;
   forall_nodes(node, graph) {
-    auto found = map.find(node);
-    if (found != map.end()) {
-      const M* mat = found->second;
-      std::pair<std::shared_ptr<ogdf::Graph>,
-                std::shared_ptr<ogdf::GraphAttributes>>
-          pair = qvdraw::graph_factory::graph(*mat);
-      ogdf::Graph& n_graph = *pair.first;
-      ogdf::GraphAttributes& n_attr = *pair.second;
-      qvlayout::layout(n_graph, n_attr);
-      box_quiver(os, "node" + int_to_str(node->index()), n_graph, n_attr,
-                 colouring.vertex_colour(mat));
-    } else {
-      /* Node is not a quiver/seed.
-       * This happens when the graph is not completely contstructed e.g. in the
-       * case where the exchange graph would otherwise be infinite. */
-      nodes_to_remove.push_back(node);
+    const M* mat = table[node->index()];
+    if (mat != nullptr) {
+      vertices.push_back(node);
+      quivers.push_back(mat);
+      colours.push_back(colouring.vertex_colour(mat));
     }
   }
-  os << "\\scalebox{\\picscale}{%" << os.widen('\n');
-  os << "\\begin{tikzpicture}[x=\\grsize,y=\\grsize,scale=\\grscale]"
-     << os.widen('\n');
-  forall_nodes(node, graph) {
-    if (std::find(nodes_to_remove.begin(), nodes_to_remove.end(), node) !=
-        nodes_to_remove.end()) {
-      continue;
+  /* Without a warm start all the vertices are in a single level, otherwise
+   * each level is laid out starting from the layouts of the level before. */
+  const bool warm_start = opts.warm_start && same_vertices(initial);
+  if (opts.warm_start && !warm_start) {
+    std::cerr << "Warm starts are only used for labelled graphs"
+              << std::cerr.widen('\n');
+  }
+  std::vector<size_t> parent(vertices.size(), NO_PARENT);
+  std::vector<std::vector<size_t>> levels;
+  if (warm_start) {
+    qvdraw::NodeEquals<const M*> equals;
+    size_t root = 0;
+    while (root < quivers.size() && !equals(quivers[root], &initial)) {
+      ++root;
     }
-    std::string name = "node" + int_to_str(node->index());
-    os << "\\node[inner sep=0pt,outer sep=0pt]"
-          " (n"
-       << node->index() << ") at (" << attr.x(node) << "," << attr.y(node)
-       << "){\\usebox{\\node" << int_to_str(node->index()) << "}};"
-       << os.widen('\n');
-    const M* mat = map.find(node)->second;
-    if (labelling.has_label(mat)) {
-      os << "\\node[draw,very thin,anchor=north east,"
-         << colouring.vertex_colour(mat) << "] at (n" << node->index()
-         << ".north west) {" << labelling.label(mat) << "};" << os.widen('\n');
+    levels = bfs_levels(graph, vertices, root < quivers.size() ? root : 0,
+                        parent);
+  } else {
+    levels.emplace_back(vertices.size());
+    std::iota(levels.front().begin(), levels.front().end(), 0);
+  }
+  /* Each vertex is laid out and drawn on its own, then the boxes are written
+   * in node order so the output does not depend on the number of threads. */
+  std::vector<std::string> boxes(vertices.size());
+  std::vector<qvlayout::LayoutCache::Coords> coords(vertices.size());
+  /* Each picture is built and freed by the thread drawing it, so only one per
+   * thread is held at once. Building copies the GiNaC expressions of a seed,
+   * which cannot happen on more than one thread at once, and the OGDF graphs
+   * are allocated and freed under the same lock so they never pass between
+   * threads. */
+  std::mutex build;
+  for (const std::vector<size_t>& level : levels) {
+    qvdraw::parallel_for(level.size(), opts.jobs, [&](size_t l) {
+      const size_t i = level[l];
+      Picture picture;
+      {
+        std::lock_guard<std::mutex> lock(build);
+        picture = qvdraw::graph_factory::graph(*quivers[i]);
+      }
+      try {
+        ogdf::Graph& n_graph = *picture.first;
+        ogdf::GraphAttributes& n_attr = *picture.second;
+        const qvlayout::LayoutCache::Coords* start =
+            parent[i] == NO_PARENT ? nullptr : &coords[parent[i]];
+        qvlayout::layout(quiver_of(*quivers[i]), n_graph, n_attr, 10,
+                         qvlayout::Method::Energy, cache, start);
+        if (warm_start) {
+          ogdf::node n;
+          forall_nodes(n, n_graph) {
+            coords[i].emplace_back(n_attr.x(n), n_attr.y(n));
+          }
+        }
+        if (opts.glyphs) {
+          boxes[i] = glyph(n_graph, n_attr, colours[i]);
+        } else {
+          TexBuffer box;
+          box_quiver(box, "node" + int_to_str(vertices[i]->index()), n_graph,
+                     n_attr, colours[i]);
+          boxes[i] = box.str();
+        }
+      } catch (...) {
+        std::lock_guard<std::mutex> lock(build);
+        picture = Picture();
+        throw;
+      }
+      std::lock_guard<std::mutex> lock(build);
+      picture = Picture();
+    });
+  }
+  TexBuffer out(os);
+  if (!opts.glyphs) {
+    for (std::string& box : boxes) {
+      out << box;
+      std::string().swap(box);
     }
+    draw_graph(out, graph, attr, table, colouring, labelling);
+    return;
   }
-  ogdf::edge e;
-  forall_edges(e, graph) {
-    if (std::find_if(nodes_to_remove.begin(), nodes_to_remove.end(),
-                     [&e](ogdf::node node) -> bool {
-                       return (e->source()->index() == node->index()) ||
-                              (e->target()->index() == node->index());
-                     }) != nodes_to_remove.end()) {
-      continue;
+  /* Vertices with the same drawing share the box of the first of them. */
+  std::unordered_map<std::string, int> saved;
+  std::vector<int> glyphs(table.size(), 0);
+  for (size_t i = 0; i < vertices.size(); ++i) {
+    auto found = saved.emplace(std::move(boxes[i]), saved.size());
+    int number = found.first->second;
+    if (found.second) {
+      std::string name = "glyph" + int_to_str(number);
+      out << "\\newsavebox{\\" << name << "}%\n";
+      out << "\\sbox{\\" << name << "}{%\n";
+      out << "\\scalebox{\\qvscale}{%\n";
+      out << found.first->first << "}}%\n";
     }
-    os << "\\draw[line width=.05pt,";
-    os << colouring.edge_colour(map.find(e->source())->second,
-                                map.find(e->target())->second);
-    os << "](n" << e->source()->index() << ") -- (n" << e->target()->index()
-       << ");" << os.widen('\n');
+    glyphs[vertices[i]->index()] = number;
   }
-  os << "\\end{tikzpicture}}%" << os.widen('\n');
+  draw_graph(out, graph, attr, table, colouring, labelling, &glyphs);
 }
 template <class M,
           class Colouring,
           class Graph,
           class Label = vertex_label::NoLabel>
-void output_multi_graph(const Graph& multi_gr, std::ostream& os) {
-  /*
-   * NB: The std::move here is important. Otherwise the graph ends up being
-   * copied for some stupid reason. Then the nodes in the graph are different
-   * to the nodes in the map.
-   */
-  qvdraw::GraphPair<M> pair =
-      std::move(qvdraw::graph_factory::multi_graph<M>(multi_gr));
-  qvdraw::NodeMap<M>& map = pair.second;
-  ogdf::Graph& graph = pair.first;
+void output_multi_graph(const Graph& multi_gr, const M& initial,
+                        std::ostream& os, const DrawOptions& opts) {
+  qvdraw::CsrGraph<M> csr(multi_gr);
+  ogdf::Graph graph;
+  qvdraw::ogdf_graph(csr, graph);
+  std::vector<const M*> table(csr.size());
+  for (size_t i = 0; i < csr.size(); ++i) {
+    table[i] = csr.node(i);
+  }
   ogdf::GraphAttributes attr(graph);
-  qvlayout::layout(graph, attr, 10, qvlayout::Method::Energy);
+  layout_graph(graph, attr, table, opts);
+  save_binary(opts, table, graph, attr);
 
   qv2tex::preamble(os);
   qv2tex::begin(os);
-  qv2tex::draw_multi_graph<M, Colouring, Label>(os, map, graph, attr);
+  qv2tex::draw_multi_graph<M, Colouring, Label>(os, table, graph, attr,
+                                                initial, opts);
+  qv2tex::end(os);
+}
+/*
+ * Explore the graph, saving its state to the checkpoint file every so often
+ * and once finished. If resuming, the exploration carries on from the state in
+ * the file, so a larger limit only explores the new part of the graph. The
+ * vertices already saved are all kept, so the limit cannot be lower than
+ * their number.
+ */
+template <class Node, class Step, class Visitor>
+std::deque<Node> checkpointed(const Node& initial, const Step& step,
+                              Visitor& visitor, size_t limit,
+                              const DrawOptions& opts) {
+  namespace explore = qvdraw::explore;
+  explore::State<Node> state =
+      opts.resume ? explore::load(opts.checkpoint, initial,
+                                  opts.checkpoint_flags)
+                  : explore::State<Node>(initial);
+  if (state.nodes.size() > limit) {
+    throw std::runtime_error(opts.checkpoint + " already has " +
+                             std::to_string(state.nodes.size()) +
+                             " vertices, more than the limit given with -n");
+  }
+  explore::Checkpointer<Node> saver(opts.checkpoint, opts.checkpoint_interval,
+                                    opts.checkpoint_flags);
+  explore::resume(state, step, visitor, limit, saver);
+  explore::save(opts.checkpoint, state, opts.checkpoint_flags);
+  return std::move(state.nodes);
+}
+/*
+ * Explore the graph from the initial quiver or seed straight into an
+ * ogdf::Graph, without first building the libqv graph and the maps between
+ * the two.
+ */
+template <class M, class Colouring, class Step>
+void output_explored(const M& initial, const Step& step, size_t limit,
+                     std::ostream& os, const DrawOptions& opts) {
+  typedef typename std::remove_const<M>::type Node;
+  ogdf::Graph graph;
+  qvdraw::explore::GraphBuilder builder(graph);
+  std::deque<Node> nodes;
+  if (opts.checkpoint.empty()) {
+    nodes = qvdraw::explore::explore(initial, step, builder, limit);
+  } else {
+    nodes = checkpointed(Node(initial), step, builder, limit, opts);
+  }
+  std::vector<const M*> table;
+  table.reserve(nodes.size());
+  for (const auto& node : nodes) {
+    table.push_back(&node);
+  }
+  ogdf::GraphAttributes attr(graph);
+  layout_graph(graph, attr, table, opts);
+  save_binary(opts, table, graph, attr);
+
+  qv2tex::preamble(os);
+  qv2tex::begin(os);
+  qv2tex::draw_multi_graph<M, Colouring>(os, table, graph, attr, initial,
+                                         opts);
+  qv2tex::end(os);
+}
+/* Explore and draw the graph of mutations of the initial quiver or seed. */
+template <class M>
+void output_mutations(const M& initial, bool green, size_t limit,
+                      std::ostream& os, const DrawOptions& opts) {
+  qvdraw::explore::MutationStep<typename std::remove_const<M>::type> step(
+      green);
+  if (green) {
+    output_explored<M, colouring::GreenSeqExistence<M>>(initial, step, limit,
+                                                        os, opts);
+  } else {
+    output_explored<M, colouring::AllBlack>(initial, step, limit, os, opts);
+  }
+}
+/* Explore the graph of mutations of the quiver on opts.jobs threads. */
+template <class M>
+void output_parallel(const M& initial, bool green, size_t limit,
+                     std::ostream& os, const DrawOptions& opts) {
+  typedef typename std::remove_const<M>::type Node;
+  qvdraw::explore::MutationStep<Node> step(green);
+  qvdraw::explore::ExploredGraph<Node> graph =
+      qvdraw::explore::parallel_explore(Node(initial), step, opts.jobs, limit);
+  if (green) {
+    output_multi_graph<M, colouring::GreenSeqExistence<M>>(graph, initial, os,
+                                                           opts);
+  } else {
+    output_multi_graph<M, colouring::AllBlack>(graph, initial, os, opts);
+  }
+}
+/*
+ * Draw a graph read from a .qvb file. If its nodes have quivers then it is
+ * drawn as a multi-graph, otherwise as a single quiver. The positions in the
+ * file are used if it has them, so a saved graph is not laid out again.
+ */
+void output_binary(const std::string& path, std::ostream& os,
+                   const DrawOptions& opts) {
+  qvdraw::qvb::MappedGraph mapped(path);
+  std::pair<std::shared_ptr<ogdf::Graph>,
+            std::shared_ptr<ogdf::GraphAttributes>>
+      pair = qvdraw::graph_factory::graph(mapped);
+  ogdf::Graph& graph = *pair.first;
+  ogdf::GraphAttributes& attr = *pair.second;
+  if (mapped.size() == 0 || !mapped.has_matrix(0)) {
+    if (!mapped.has_coordinates()) {
+      qvlayout::layout(qvdraw::graph_factory::matrix(graph, attr), graph, attr,
+                       10, qvlayout::Method::Energy, opts.cache);
+    }
+    qv2tex::preamble(os);
+    qv2tex::begin(os);
+    {
+      TexBuffer out(os);
+      draw_quiver(out, graph, attr);
+    }
+    qv2tex::end(os);
+    return;
+  }
+  typedef const cluster::QuiverMatrix M;
+  std::deque<cluster::QuiverMatrix> quivers;
+  std::vector<const M*> table(mapped.size(), nullptr);
+  for (size_t i = 0; i < mapped.size(); ++i) {
+    if (mapped.has_matrix(i)) {
+      quivers.emplace_back(mapped.matrix(i));
+      table[i] = &quivers.back();
+    }
+  }
+  if (!mapped.has_coordinates()) {
+    layout_graph(graph, attr, table, opts);
+  }
+  qv2tex::preamble(os);
+  qv2tex::begin(os);
+  qv2tex::draw_multi_graph<M, colouring::AllBlack>(os, table, graph, attr,
+                                                   *table[0], opts);
   qv2tex::end(os);
 }
 }
 void usage() {
-  std::cout << "qv2tex -lr [-n number] [-q|m|g|e|c quiver] [-a cartan]"
+  std::cout << "qv2tex -lr [-n number] [-q|m|g|e|c quiver] [-a cartan] "
+               "[-b file] [-B file] [-k dir [-K MB]] [-j jobs] [-w] [-d] [-s]"
+            << std::endl;
+  std::cout << "       [-M moves] [--auto-layout] [--layout-budget seconds]"
+            << std::endl;
+  std::cout << "       [--checkpoint file [--checkpoint-interval seconds]] "
+               "[--resume]"
+            << std::endl;
+  std::cout << "       [--previous file [--relax-previous]] [--vectors g|c]"
             << std::endl;
   std::cout << "Takes a qv matrix and outputs the TeX to draw the quiver."
             << std::endl;
   std::cout << "  -q Draw a single quiver" << std::endl;
   std::cout << "  -m Draw the move graph of a quiver" << std::endl;
+  std::cout << "  -M File of extra moves to use with -m" << std::endl;
   std::cout << "  -g Draw the quiver graph of a quiver" << std::endl;
   std::cout << "  -e Draw the exchange graph of a quiver with cluster (x1 ... )"
             << std::endl;
@@ -309,18 +673,107 @@ void usage() {
   std::cout
       << "  -r Don't compute mutations which do not lead to green sequences"
       << std::endl;
+  std::cout << "  -k Directory to cache quiver layouts in" << std::endl;
+  std::cout << "  -K Size limit of the layout cache in megabytes" << std::endl;
+  std::cout << "  -j Number of threads used to explore the graph (with -g) and"
+               " lay out the vertex quivers. Default is 1"
+            << std::endl;
+  std::cout << "  -w Start each vertex layout from that of a neighbour"
+            << std::endl;
+  std::cout << "  -d Save each distinct vertex drawing only once" << std::endl;
+  std::cout << "  -s Explore the graph straight into the drawing (not with -c)"
+            << std::endl;
+  std::cout << "  -b Draw a graph saved in the binary qvb format" << std::endl;
+  std::cout << "  -B Also save the laid out graph to the file in the qvb format"
+            << std::endl;
+  std::cout << "  --checkpoint Save the explored graph to the file every so "
+               "often (not with -c)"
+            << std::endl;
+  std::cout
+      << "  --checkpoint-interval Seconds between checkpoints, default 300"
+      << std::endl;
+  std::cout << "  --resume Carry on from the graph saved in the checkpoint"
+            << std::endl;
+  std::cout << "  --auto-layout Choose the graph layout quality from its size"
+            << std::endl;
+  std::cout << "  --layout-budget Refine the graph layout for up to this many "
+               "seconds (implies --auto-layout)"
+            << std::endl;
+  std::cout << "  --previous Keep the layout of the vertices drawn in this GML "
+               "or qvb file and only place the new ones (not with -e or -c)"
+            << std::endl;
+  std::cout << "  --relax-previous Relax the whole graph after placing the new "
+               "vertices"
+            << std::endl;
+  std::cout << "  --vectors Label the exchange graph (with -e) by the "
+               "g-vectors or c-vectors of the seeds, without cluster variables"
+            << std::endl;
 }
-enum Func { quiver, move, graph, exchange, cartan, unset };
+/*
+ * Parse a number given on the command line, returning false unless the whole
+ * string is a number of at least zero which fits in the result.
+ */
+bool parse_number(const char* str, size_t& result) {
+  if (str[0] == '-') {
+    return false;
+  }
+  try {
+    size_t used = 0;
+    result = std::stoul(str, &used);
+    return used > 0 && str[used] == '\0';
+  } catch (const std::logic_error&) {
+    return false;
+  }
+}
+bool parse_number(const char* str, double& result) {
+  try {
+    size_t used = 0;
+    result = std::stod(str, &used);
+    return used > 0 && str[used] == '\0' && result >= 0;
+  } catch (const std::logic_error&) {
+    return false;
+  }
+}
+enum Func { quiver, move, graph, exchange, cartan, binary, unset };
+/* Values returned by getopt_long for the options without a short form. */
+enum LongOption {
+  CHECKPOINT = 256,
+  CHECKPOINT_INTERVAL,
+  RESUME,
+  AUTO_LAYOUT,
+  LAYOUT_BUDGET,
+  PREVIOUS,
+  RELAX_PREVIOUS,
+  VECTORS
+};
 int main(int argc, char* argv[]) {
+  qvdraw::trace::init(argc, argv);
   Func func = unset;
   bool labelled = false;
   bool green = false;
+  bool streaming = false;
   std::string mat_str;
   std::string cartan_str;
+  std::string extra_moves;
+  std::string vectors;
   size_t limit = SIZE_MAX;
+  std::string cache_dir;
+  size_t cache_bytes = qvlayout::LayoutCache::DEFAULT_MAX_BYTES;
+  qv2tex::DrawOptions opts;
   int c;
 
-  while ((c = getopt(argc, argv, "c:q:m:g:e:ln:ra:")) != -1) {
+  const struct option long_options[] = {
+      {"checkpoint", required_argument, nullptr, CHECKPOINT},
+      {"checkpoint-interval", required_argument, nullptr, CHECKPOINT_INTERVAL},
+      {"resume", no_argument, nullptr, RESUME},
+      {"auto-layout", no_argument, nullptr, AUTO_LAYOUT},
+      {"layout-budget", required_argument, nullptr, LAYOUT_BUDGET},
+      {"previous", required_argument, nullptr, PREVIOUS},
+      {"relax-previous", no_argument, nullptr, RELAX_PREVIOUS},
+      {"vectors", required_argument, nullptr, VECTORS},
+      {nullptr, 0, nullptr, 0}};
+  while ((c = getopt_long(argc, argv, "c:q:m:M:g:e:ln:ra:k:K:j:wdsb:B:",
+                          long_options, nullptr)) != -1) {
     switch (c) {
       case 'c':
         func = Func::cartan;
@@ -334,6 +787,9 @@ int main(int argc, char* argv[]) {
         func = Func::move;
         mat_str = optarg;
         break;
+      case 'M':
+        extra_moves = optarg;
+        break;
       case 'g':
         func = Func::graph;
         mat_str = optarg;
@@ -346,7 +802,10 @@ int main(int argc, char* argv[]) {
         labelled = true;
         break;
       case 'n':
-        limit = std::stoul(optarg);
+        if (!parse_number(optarg, limit)) {
+          usage();
+          return 1;
+        }
         break;
       case 'r':
         green = true;
@@ -354,6 +813,72 @@ int main(int argc, char* argv[]) {
       case 'a':
         cartan_str = optarg;
         break;
+      case 'k':
+        cache_dir = optarg;
+        break;
+      case 'K':
+        if (!parse_number(optarg, cache_bytes)) {
+          usage();
+          return 1;
+        }
+        cache_bytes *= 1024 * 1024;
+        break;
+      case 'j':
+        if (!parse_number(optarg, opts.jobs)) {
+          usage();
+          return 1;
+        }
+        break;
+      case 'w':
+        opts.warm_start = true;
+        break;
+      case 'd':
+        opts.glyphs = true;
+        break;
+      case 's':
+        streaming = true;
+        break;
+      case 'b':
+        func = Func::binary;
+        mat_str = optarg;
+        break;
+      case 'B':
+        opts.binary = optarg;
+        break;
+      case CHECKPOINT:
+        opts.checkpoint = optarg;
+        break;
+      case CHECKPOINT_INTERVAL: {
+        size_t seconds;
+        if (!parse_number(optarg, seconds)) {
+          usage();
+          return 1;
+        }
+        opts.checkpoint_interval = std::chrono::seconds(seconds);
+        break;
+      }
+      case RESUME:
+        opts.resume = true;
+        break;
+      case AUTO_LAYOUT:
+        opts.auto_layout = true;
+        break;
+      case LAYOUT_BUDGET:
+        opts.auto_layout = true;
+        if (!parse_number(optarg, opts.layout_budget)) {
+          usage();
+          return 1;
+        }
+        break;
+      case PREVIOUS:
+        opts.previous = optarg;
+        break;
+      case RELAX_PREVIOUS:
+        opts.relax_previous = true;
+        break;
+      case VECTORS:
+        vectors = optarg;
+        break;
       case '?':
         usage();
         return 1;
@@ -366,106 +891,231 @@ int main(int argc, char* argv[]) {
     usage();
     return 1;
   }
-  std::ostream& os = std::cout;
-  if (func == Func::quiver) {
-    cluster::IntMatrix matrix(mat_str);
-    std::pair<std::shared_ptr<ogdf::Graph>,
-              std::shared_ptr<ogdf::GraphAttributes>>
-        pair = qvdraw::graph_factory::graph(matrix);
-    ogdf::Graph& graph = *pair.first;
-    ogdf::GraphAttributes& attr = *pair.second;
-    qvlayout::layout(graph, attr);
-    qv2tex::preamble(os);
-    qv2tex::begin(os);
-    qv2tex::draw_quiver(os, graph, attr);
-    qv2tex::end(os);
-  } else if (func == Func::move) {
-    typedef cluster::EquivQuiverMatrix M;
-    M matrix(mat_str);
-    cluster::MoveGraph<M> move(matrix, qvdraw::consts::Moves);
-    qv2tex::output_multi_graph<const M, qv2tex::colouring::AllBlack>(move, os);
-  } else if (labelled && func == Func::graph) {
-    typedef const cluster::QuiverMatrix M;
-    M matrix(mat_str);
-    if (green) {
-      cluster::GreenLabelledQuiverGraph move(matrix, matrix.num_rows(), limit);
-      qv2tex::output_multi_graph<M, qv2tex::colouring::GreenSeqExistence<M>>(
-          move, os);
-    } else {
-      cluster::LabelledQuiverGraph move(matrix, matrix.num_rows(), limit);
-      qv2tex::output_multi_graph<M, qv2tex::colouring::AllBlack>(move, os);
-    }
-  } else if (func == Func::graph) {
-    typedef const cluster::EquivQuiverMatrix M;
-    M matrix(mat_str);
-    if (green) {
-      cluster::GreenQuiverGraph move(matrix, matrix.num_rows(), limit);
-      qv2tex::output_multi_graph<M, qv2tex::colouring::GreenSeqExistence<M>>(
-          move, os);
-    } else {
-      cluster::QuiverGraph move(matrix, matrix.num_rows(), limit);
-      qv2tex::output_multi_graph<M, qv2tex::colouring::AllBlack>(move, os);
-    }
-  } else if (labelled && func == Func::exchange) {
-    typedef const cluster::LabelledSeed M;
-    cluster::QuiverMatrix matrix(mat_str);
-    M::Cluster cluster = default_cluster(matrix.num_rows());
-    M seed(matrix, cluster);
-    if (green) {
-      cluster::LabelledExchangeGraph move(seed, seed.size(), limit);
-      qv2tex::output_multi_graph<M, qv2tex::colouring::GreenSeqExistence<M>>(
-          move, os);
-    } else {
-      cluster::LabelledExchangeGraph move(seed, seed.size(), limit);
-      qv2tex::output_multi_graph<M, qv2tex::colouring::AllBlack>(move, os);
-    }
+  if (streaming && func == Func::cartan) {
+    std::cerr << "Cannot explore the Cartan exchange graph with -s"
+              << std::cerr.widen('\n');
+    return 1;
+  }
+  if (!opts.checkpoint.empty() && func == Func::cartan) {
+    std::cerr << "Cannot checkpoint the Cartan exchange graph"
+              << std::cerr.widen('\n');
+    return 1;
+  }
+  if (!vectors.empty() && vectors != "g" && vectors != "c") {
+    std::cerr << "--vectors must be g or c" << std::cerr.widen('\n');
+    return 1;
+  }
+  if (!vectors.empty() && func != Func::exchange) {
+    std::cerr << "--vectors can only be used with -e" << std::cerr.widen('\n');
+    return 1;
+  }
+  if (opts.resume && opts.checkpoint.empty()) {
+    std::cerr << "--resume needs a --checkpoint file" << std::cerr.widen('\n');
+    return 1;
+  }
+  if (!opts.previous.empty() &&
+      (func == Func::exchange || func == Func::cartan)) {
+    /* Earlier layouts only record the quiver of each vertex, which is shared
+     * by many seeds, and by quivers with different Cartan matrices. */
+    std::cerr << "--previous cannot be used with -e or -c"
+              << std::cerr.widen('\n');
+    return 1;
+  }
+  if (!opts.previous.empty() && opts.auto_layout) {
+    std::cerr << "--previous cannot be used with --auto-layout or "
+                 "--layout-budget" << std::cerr.widen('\n');
+    return 1;
+  }
+  if (func == Func::move) {
+    opts.checkpoint_flags.graph = "move";
   } else if (func == Func::exchange) {
-    typedef const cluster::Seed M;
-    cluster::QuiverMatrix matrix(mat_str);
-    M::Cluster cluster = default_cluster(matrix.num_rows());
-    M seed(matrix, cluster);
-    if (green) {
-      cluster::ExchangeGraph move(seed, seed.size(), limit);
-      qv2tex::output_multi_graph<M, qv2tex::colouring::GreenSeqExistence<M>>(
-          move, os);
-    } else {
-      cluster::ExchangeGraph move(seed, seed.size(), limit);
-      qv2tex::output_multi_graph<M, qv2tex::colouring::AllBlack>(move, os);
-    }
-  } else if (func == Func::cartan) {
-    typedef const refl::cartan_exchange::CartanQuiver M;
-    cluster::EquivQuiverMatrix m(mat_str);
-    arma::Mat<int> cartan;
+    opts.checkpoint_flags.graph =
+        vectors.empty() ? "exchange" : vectors + "-vectors";
+  } else {
+    opts.checkpoint_flags.graph = "graph";
+  }
+  opts.checkpoint_flags.green = green;
+  opts.checkpoint_flags.labelled = labelled;
+  /* Checkpoints are only taken by the explorer used for streaming. */
+  const bool explorer = streaming || !opts.checkpoint.empty();
+  /* Only labelled quivers and g-vector seeds can be compared on more than one
+   * thread, and the streaming explorer always uses one. */
+  const bool parallel_graph =
+      !explorer && ((labelled && func == Func::graph) ||
+                    (!vectors.empty() && func == Func::exchange));
+  if (opts.jobs > 1 && !parallel_graph &&
+      (func == Func::graph || func == Func::exchange || func == Func::move ||
+       func == Func::cartan)) {
+    std::cerr << "The graph is explored on one thread, -j only lays out the "
+                 "vertex quivers" << std::cerr.widen('\n');
+  }
+  std::ostream& os = std::cout;
+  std::unique_ptr<qvlayout::LayoutCache> cache;
+  if (!cache_dir.empty()) {
+    cache.reset(new qvlayout::LayoutCache(cache_dir, cache_bytes));
+    opts.cache = cache.get();
+  }
+  try {
+    if (func == Func::binary) {
+      qv2tex::output_binary(mat_str, os, opts);
+    } else if (func == Func::quiver) {
+      cluster::IntMatrix matrix(mat_str);
+      std::pair<std::shared_ptr<ogdf::Graph>,
+                std::shared_ptr<ogdf::GraphAttributes>>
+          pair = qvdraw::graph_factory::graph(matrix);
+      ogdf::Graph& graph = *pair.first;
+      ogdf::GraphAttributes& attr = *pair.second;
+      qvlayout::layout(matrix, graph, attr, 10, qvlayout::Method::Energy,
+                       cache.get());
+      if (!opts.binary.empty()) {
+        qvdraw::graph_factory::binary(graph, attr).write(opts.binary);
+      }
+      qv2tex::preamble(os);
+      qv2tex::begin(os);
+      {
+        qv2tex::TexBuffer out(os);
+        qv2tex::draw_quiver(out, graph, attr);
+      }
+      qv2tex::end(os);
+    } else if (func == Func::move) {
+      typedef cluster::EquivQuiverMatrix M;
+      M matrix(mat_str);
+      std::vector<cluster::MMIMove> moves = qvdraw::consts::moves();
+      std::vector<qvdraw::consts::MovePatterns> patterns =
+          qvdraw::consts::patterns();
+      if (!extra_moves.empty()) {
+        std::vector<cluster::MMIMove> more =
+            qvdraw::consts::load_moves(extra_moves, &patterns);
+        moves.insert(moves.end(), more.begin(), more.end());
+      }
+      if (explorer) {
+        qvdraw::MoveIndex index(patterns);
+        qvdraw::explore::MoveStep<M> step(moves, &index);
+        qv2tex::output_explored<const M, qv2tex::colouring::AllBlack>(
+            matrix, step, limit, os, opts);
+        return 0;
+      }
+      /* The move index cannot be shared between threads, so the graph is
+       * explored on one. */
+      qvdraw::MoveIndex index(patterns);
+      qvdraw::explore::MoveStep<M> step(moves, &index);
+      qv2tex::output_multi_graph<const M, qv2tex::colouring::AllBlack>(
+          qvdraw::explore::parallel_explore(matrix, step, 1, limit), matrix,
+          os, opts);
+    } else if (labelled && func == Func::graph) {
+      typedef const cluster::QuiverMatrix M;
+      M matrix(mat_str);
+      if (explorer) {
+        qv2tex::output_mutations(matrix, green, limit, os, opts);
+      } else if (opts.jobs > 1) {
+        qv2tex::output_parallel(matrix, green, limit, os, opts);
+      } else if (green) {
+        cluster::GreenLabelledQuiverGraph move(matrix, matrix.num_rows(),
+                                               limit);
+        qv2tex::output_multi_graph<M, qv2tex::colouring::GreenSeqExistence<M>>(
+            move, matrix, os, opts);
+      } else {
+        cluster::LabelledQuiverGraph move(matrix, matrix.num_rows(), limit);
+        qv2tex::output_multi_graph<M, qv2tex::colouring::AllBlack>(
+            move, matrix, os, opts);
+      }
+    } else if (func == Func::graph) {
+      typedef const cluster::EquivQuiverMatrix M;
+      M matrix(mat_str);
+      if (explorer) {
+        qv2tex::output_mutations(matrix, green, limit, os, opts);
+      } else if (opts.jobs > 1) {
+        qv2tex::output_parallel(matrix, green, limit, os, opts);
+      } else if (green) {
+        cluster::GreenQuiverGraph move(matrix, matrix.num_rows(), limit);
+        qv2tex::output_multi_graph<M, qv2tex::colouring::GreenSeqExistence<M>>(
+            move, matrix, os, opts);
+      } else {
+        cluster::QuiverGraph move(matrix, matrix.num_rows(), limit);
+        qv2tex::output_multi_graph<M, qv2tex::colouring::AllBlack>(
+            move, matrix, os, opts);
+      }
+    } else if (func == Func::exchange && !vectors.empty()) {
+      typedef const qvdraw::GVectorSeed M;
+      cluster::QuiverMatrix matrix(mat_str);
+      M seed(matrix, labelled, vectors == "c" ? M::Vectors::C : M::Vectors::G);
+      if (explorer) {
+        qv2tex::output_mutations(seed, green, limit, os, opts);
+      } else {
+        /* The seeds hold no GiNaC expressions, so can be explored on any
+         * number of threads. */
+        qv2tex::output_parallel(seed, green, limit, os, opts);
+      }
+    } else if (labelled && func == Func::exchange) {
+      typedef const cluster::LabelledSeed M;
+      cluster::QuiverMatrix matrix(mat_str);
+      M::Cluster cluster = default_cluster(matrix.num_rows());
+      M seed(matrix, cluster);
+      if (explorer) {
+        qv2tex::output_mutations(seed, green, limit, os, opts);
+      } else if (green) {
+        cluster::LabelledExchangeGraph move(seed, seed.size(), limit);
+        qv2tex::output_multi_graph<M, qv2tex::colouring::GreenSeqExistence<M>>(
+            move, seed, os, opts);
+      } else {
+        cluster::LabelledExchangeGraph move(seed, seed.size(), limit);
+        qv2tex::output_multi_graph<M, qv2tex::colouring::AllBlack>(
+            move, seed, os, opts);
+      }
+    } else if (func == Func::exchange) {
+      typedef const cluster::Seed M;
+      cluster::QuiverMatrix matrix(mat_str);
+      M::Cluster cluster = default_cluster(matrix.num_rows());
+      M seed(matrix, cluster);
+      if (explorer) {
+        qv2tex::output_mutations(seed, green, limit, os, opts);
+      } else if (green) {
+        cluster::ExchangeGraph move(seed, seed.size(), limit);
+        qv2tex::output_multi_graph<M, qv2tex::colouring::GreenSeqExistence<M>>(
+            move, seed, os, opts);
+      } else {
+        cluster::ExchangeGraph move(seed, seed.size(), limit);
+        qv2tex::output_multi_graph<M, qv2tex::colouring::AllBlack>(
+            move, seed, os, opts);
+      }
+    } else if (func == Func::cartan) {
+      typedef const refl::cartan_exchange::CartanQuiver M;
+      cluster::EquivQuiverMatrix m(mat_str);
+      arma::Mat<int> cartan;
 
-    if (cartan_str.empty()) {
-      refl::CompatibleCartanIterator init_cartan_iter(m);
+      if (cartan_str.empty()) {
+        refl::CompatibleCartanIterator init_cartan_iter(m);
 
-      if (!init_cartan_iter.has_next()) {
-        std::cerr << "Quiver has no fully compatible matrices"
-                  << std::cerr.widen('\n');
-        return 5;
-      }
-      cartan = init_cartan_iter.next();
-    } else {
-      cluster::QuiverMatrix cartan_qv{cartan_str};
-      cartan = refl::util::to_arma(cartan_qv);
+        if (!init_cartan_iter.has_next()) {
+          std::cerr << "Quiver has no fully compatible matrices"
+                    << std::cerr.widen('\n');
+          return 5;
+        }
+        cartan = init_cartan_iter.next();
+      } else {
+        cluster::QuiverMatrix cartan_qv{cartan_str};
+        cartan = refl::util::to_arma(cartan_qv);
 
-      refl::FullyCompatibleCheck comp_check;
-      if (!comp_check(m, cartan)) {
-        std::cerr << "Specified cartan matrix is not fully compatible. Not "
-                     "continuing."
-                  << std::endl;
-        return 6;
+        refl::FullyCompatibleCheck comp_check;
+        if (!comp_check(m, cartan)) {
+          std::cerr << "Specified cartan matrix is not fully compatible. Not "
+                       "continuing."
+                    << std::endl;
+          return 6;
+        }
       }
-    }
 
-    refl::cartan_exchange::CartanQuiver initial{m, cartan, true};
+      refl::cartan_exchange::CartanQuiver initial{m, cartan, true};
 
-    refl::CartanExchangeGraph graph(initial, m.num_rows(), limit);
-    qv2tex::output_multi_graph<M, qv2tex::colouring::FullyCompatible,
-                               refl::CartanExchangeGraph,
-                               qv2tex::vertex_label::NonCompatibleLabel>(graph,
-                                                                         os);
+      refl::CartanExchangeGraph graph(initial, m.num_rows(), limit);
+      qv2tex::output_multi_graph<M, qv2tex::colouring::FullyCompatible,
+                                 refl::CartanExchangeGraph,
+                                 qv2tex::vertex_label::NonCompatibleLabel>(
+          graph, initial, os, opts);
+    }
+  } catch (const std::runtime_error& e) {
+    std::cerr << e.what() << std::cerr.widen('\n');
+    return 1;
   }
   return 0;
 }
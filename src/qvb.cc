@@ -0,0 +1,303 @@
+/*
+ * qvb.cc
+ * Copyright 2014-2015 John Lawson
+ *
+ * This program is free software: you can redistribute it and/or modify
+ * it under the terms of the GNU General Public License as published by
+ * the Free Software Foundation, either version 3 of the License, or
+ * (at your option) any later version.
+ *
+ * This program is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ * GNU General Public License for more details.
+ *
+ * You should have received a copy of the GNU General Public License
+ * along with this program.  If not, see <http://www.gnu.org/licenses/>.
+ */
+#include "qvb.h"
+
+#include <fcntl.h>
+#include <sys/mman.h>
+#include <sys/stat.h>
+#include <unistd.h>
+
+#include <algorithm>
+#include <cstring>
+#include <fstream>
+#include <stdexcept>
+
+#include "gml.h"
+#include "trace.h"
+
+namespace qvdraw {
+namespace qvb {
+namespace {
+const char MAGIC[4] = {'Q', 'V', 'B', '\0'};
+static_assert(sizeof(Header) % 8 == 0, "Sections must stay 8 byte aligned");
+static_assert(sizeof(int) == sizeof(int32_t), "Matrices are stored as int");
+size_t padded(size_t bytes) {
+  return (bytes + 7) & ~static_cast<size_t>(7);
+}
+/* Whether the count + 1 offsets run from 0 up to total without decreasing. */
+bool monotone(const uint64_t* offsets, uint64_t count, uint64_t total) {
+  if (offsets[0] != 0 || offsets[count] != total) {
+    return false;
+  }
+  for (uint64_t i = 0; i < count; ++i) {
+    if (offsets[i] > offsets[i + 1]) {
+      return false;
+    }
+  }
+  return true;
+}
+/* Whether each matrix record is its number of rows and columns followed by
+ * exactly that many entries, or is empty. */
+bool matrices_fit(const uint64_t* offsets, const int32_t* data,
+                  uint64_t nodes) {
+  for (uint64_t v = 0; v < nodes; ++v) {
+    const uint64_t length = offsets[v + 1] - offsets[v];
+    if (length == 0) {
+      continue;
+    }
+    if (length < 2) {
+      return false;
+    }
+    const int32_t* record = data + offsets[v];
+    if (record[0] < 0 || record[1] < 0 ||
+        static_cast<uint64_t>(record[0]) * static_cast<uint64_t>(record[1]) !=
+            length - 2) {
+      return false;
+    }
+  }
+  return true;
+}
+template <class T>
+void write_section(std::ostream& os, const T* data, size_t count) {
+  const size_t bytes = count * sizeof(T);
+  if (bytes > 0) {
+    os.write(reinterpret_cast<const char*>(data), bytes);
+  }
+  static const char zeros[8] = {};
+  os.write(zeros, padded(bytes) - bytes);
+}
+template <class T>
+void write_section(std::ostream& os, const std::vector<T>& data) {
+  write_section(os, data.data(), data.size());
+}
+/* Offsets of each string into the concatenation of them all. */
+template <class Strings, class Get>
+std::vector<uint64_t> concatenate(const Strings& strings, Get get,
+                                  std::string& chars) {
+  std::vector<uint64_t> offsets{0};
+  offsets.reserve(strings.size() + 1);
+  for (const auto& s : strings) {
+    chars += get(s);
+    offsets.push_back(chars.size());
+  }
+  return offsets;
+}
+}
+size_t Builder::add_node(const std::string& label) {
+  matrix_offsets_.push_back(matrix_data_.size());
+  node_labels_.push_back(label);
+  return node_labels_.size() - 1;
+}
+size_t Builder::add_node(const cluster::IntMatrix& matrix,
+                         const std::string& label) {
+  matrix_data_.push_back(matrix.num_rows());
+  matrix_data_.push_back(matrix.num_cols());
+  for (int i = 0; i < matrix.num_rows(); ++i) {
+    for (int j = 0; j < matrix.num_cols(); ++j) {
+      matrix_data_.push_back(matrix.get(i, j));
+    }
+  }
+  return add_node(label);
+}
+void Builder::add_edge(size_t source, size_t target, const std::string& label) {
+  edges_.push_back({source, target, label});
+}
+void Builder::set_position(size_t node, double x, double y) {
+  if (coords_.size() < 2 * size()) {
+    coords_.resize(2 * size(), 0.0);
+  }
+  coords_[2 * node] = x;
+  coords_[2 * node + 1] = y;
+}
+void Builder::write(std::ostream& os) const {
+  trace::Scope scope("write qvb");
+  const size_t nodes = size();
+  /* Counting sort of the edges by source, keeping the order they were added
+   * for each node. */
+  std::vector<uint64_t> edge_offsets(nodes + 1, 0);
+  for (const Edge& edge : edges_) {
+    ++edge_offsets[edge.source + 1];
+  }
+  for (size_t i = 0; i < nodes; ++i) {
+    edge_offsets[i + 1] += edge_offsets[i];
+  }
+  std::vector<const Edge*> sorted(edges_.size());
+  std::vector<uint64_t> fill(edge_offsets.begin(), edge_offsets.end() - 1);
+  for (const Edge& edge : edges_) {
+    sorted[fill[edge.source]++] = &edge;
+  }
+  std::vector<uint64_t> targets;
+  targets.reserve(sorted.size());
+  for (const Edge* edge : sorted) {
+    targets.push_back(edge->target);
+  }
+  std::string node_chars;
+  std::vector<uint64_t> node_offsets = concatenate(
+      node_labels_, [](const std::string& s) -> const std::string& {
+        return s;
+      }, node_chars);
+  std::string edge_chars;
+  std::vector<uint64_t> edge_label_offsets = concatenate(
+      sorted, [](const Edge* e) -> const std::string& { return e->label; },
+      edge_chars);
+
+  Header header;
+  std::memset(&header, 0, sizeof(header));
+  std::memcpy(header.magic, MAGIC, sizeof(MAGIC));
+  header.version = VERSION;
+  header.flags = coords_.empty() ? 0 : HAS_COORDS;
+  header.nodes = nodes;
+  header.edges = edges_.size();
+  header.matrix_ints = matrix_data_.size();
+  header.node_chars = node_chars.size();
+  header.edge_chars = edge_chars.size();
+  os.write(reinterpret_cast<const char*>(&header), sizeof(header));
+  write_section(os, matrix_offsets_);
+  write_section(os, matrix_data_);
+  write_section(os, node_offsets);
+  write_section(os, node_chars.data(), node_chars.size());
+  write_section(os, edge_offsets);
+  write_section(os, targets);
+  write_section(os, edge_label_offsets);
+  write_section(os, edge_chars.data(), edge_chars.size());
+  if (!coords_.empty()) {
+    std::vector<double> coords(coords_);
+    coords.resize(2 * nodes, 0.0);
+    write_section(os, coords);
+  }
+  os.flush();
+}
+void Builder::write(const std::string& path) const {
+  std::ofstream file(path, std::ios::binary);
+  write(file);
+  if (!file) {
+    throw std::runtime_error("Could not write " + path);
+  }
+  trace::count(trace::BytesWritten, file.tellp());
+}
+Builder quiver(const cluster::IntMatrix& matrix) {
+  Builder result;
+  const int size = std::max(matrix.num_rows(), matrix.num_cols());
+  for (int i = 0; i < size; ++i) {
+    result.add_node();
+  }
+  for (int i = 0; i < matrix.num_rows(); ++i) {
+    for (int j = 0; j < matrix.num_cols(); ++j) {
+      if (matrix.get(i, j) > 0) {
+        result.add_edge(i, j, gml::edge_label(matrix, i, j));
+      }
+    }
+  }
+  return result;
+}
+MappedGraph::MappedGraph(const std::string& path)
+    : data_(MAP_FAILED), length_(0) {
+  int fd = ::open(path.c_str(), O_RDONLY);
+  if (fd < 0) {
+    throw std::runtime_error("Could not open " + path);
+  }
+  struct stat st;
+  if (::fstat(fd, &st) != 0 || st.st_size < 0 ||
+      static_cast<size_t>(st.st_size) < sizeof(Header)) {
+    ::close(fd);
+    throw std::runtime_error(path + " is not a qvb file");
+  }
+  length_ = st.st_size;
+  data_ = ::mmap(nullptr, length_, PROT_READ, MAP_PRIVATE, fd, 0);
+  ::close(fd);
+  if (data_ == MAP_FAILED) {
+    throw std::runtime_error("Could not map " + path);
+  }
+  const char* base = static_cast<const char*>(data_);
+  header_ = reinterpret_cast<const Header*>(base);
+  if (std::memcmp(header_->magic, MAGIC, sizeof(MAGIC)) != 0 ||
+      header_->version != VERSION) {
+    ::munmap(data_, length_);
+    throw std::runtime_error(path + " is not a qvb file of version " +
+                             std::to_string(VERSION));
+  }
+  /* Check every section fits in the file before pointing into it, taking
+   * care that corrupt counts cannot overflow the running total. */
+  size_t pos = sizeof(Header);
+  bool valid = true;
+  auto section = [&](uint64_t count, size_t width) -> const char* {
+    if (!valid || count > (length_ - pos) / width) {
+      valid = false;
+      return nullptr;
+    }
+    const char* start = base + pos;
+    pos += padded(count * width);
+    pos = std::min(pos, length_);
+    return start;
+  };
+  const uint64_t nodes = header_->nodes;
+  const uint64_t edges = header_->edges;
+  auto offsets = [&](uint64_t count) -> const uint64_t* {
+    if (count == UINT64_MAX) {
+      valid = false;
+      return nullptr;
+    }
+    return reinterpret_cast<const uint64_t*>(
+        section(count + 1, sizeof(uint64_t)));
+  };
+  matrix_offsets_ = offsets(nodes);
+  matrix_data_ = reinterpret_cast<const int32_t*>(
+      section(header_->matrix_ints, sizeof(int32_t)));
+  node_label_offsets_ = offsets(nodes);
+  node_chars_ = section(header_->node_chars, 1);
+  edge_offsets_ = offsets(nodes);
+  targets_ = reinterpret_cast<const uint64_t*>(
+      section(edges, sizeof(uint64_t)));
+  edge_label_offsets_ = offsets(edges);
+  edge_chars_ = section(header_->edge_chars, 1);
+  coords_ = nullptr;
+  if ((header_->flags & HAS_COORDS) != 0) {
+    coords_ = reinterpret_cast<const double*>(
+        section(nodes, 2 * sizeof(double)));
+  }
+  /* Every offset and target is then checked, so the accessors can read from
+   * the mapping without any bounds checks of their own. */
+  valid = valid && monotone(edge_offsets_, nodes, edges) &&
+          monotone(matrix_offsets_, nodes, header_->matrix_ints) &&
+          monotone(node_label_offsets_, nodes, header_->node_chars) &&
+          monotone(edge_label_offsets_, edges, header_->edge_chars) &&
+          matrices_fit(matrix_offsets_, matrix_data_, nodes);
+  for (uint64_t e = 0; valid && e < edges; ++e) {
+    valid = targets_[e] < nodes;
+  }
+  if (!valid) {
+    ::munmap(data_, length_);
+    throw std::runtime_error(path + " is truncated or corrupt");
+  }
+}
+MappedGraph::~MappedGraph() {
+  ::munmap(data_, length_);
+}
+size_t MappedGraph::source(size_t e) const {
+  const uint64_t* end = edge_offsets_ + size() + 1;
+  return std::upper_bound(edge_offsets_, end, e) - edge_offsets_ - 1;
+}
+cluster::IntMatrix MappedGraph::matrix(size_t v) const {
+  if (!has_matrix(v)) {
+    return cluster::IntMatrix();
+  }
+  const int32_t* record = matrix_data_ + matrix_offsets_[v];
+  return cluster::IntMatrix(record[0], record[1], record + 2);
+}
+}
+}
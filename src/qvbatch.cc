@@ -0,0 +1,159 @@
+/**
+ * qvbatch.cc
+ * Copyright 2014-2015 John Lawson
+ *
+ * This program is free software: you can redistribute it and/or modify
+ * it under the terms of the GNU General Public License as published by
+ * the Free Software Foundation, either version 3 of the License, or
+ * (at your option) any later version.
+ *
+ * This program is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ * GNU General Public License for more details.
+ *
+ * You should have received a copy of the GNU General Public License
+ * along with this program.  If not, see <http://www.gnu.org/licenses/>.
+ */
+/**
+ * Lay out every quiver in a file of matrices, writing the numbered drawings
+ * 1.gml, 2.gml, ... or pictures 1.png, 2.png, ... in a single process.
+ */
+#include <unistd.h>
+
+#include <climits>
+#include <cstdint>
+#include <fstream>
+#include <memory>
+#include <stdexcept>
+#include <string>
+
+#include "batch.h"
+#include "trace.h"
+
+void usage() {
+	std::cout << "qvbatch [-n] [-d directory] [-f first] [-s size] [-j jobs] [-t format] [-w width] [-k dir [-K MB]] [filename]" << std::endl;
+	std::cout << "Lay out each quiver matrix in the file, one per line." << std::endl;
+	std::cout << "If no filename is specified then input is taken from stdin." << std::endl;
+	std::cout << "  -d Directory to write the drawings to. Default is ." << std::endl;
+	std::cout << "  -f Number of the first drawing. Default is 1" << std::endl;
+	std::cout << "  -s Size of the vertices in the layout. Default is 10" << std::endl;
+	std::cout << "  -j Number of quivers to lay out at once. Default is 1" << std::endl;
+	std::cout << "  -t Output format, one of gml, svg or png. Default is gml" << std::endl;
+	std::cout << "  -w Width of png pictures in pixels. Default is 400" << std::endl;
+	std::cout << "  -n Do not draw arrows on quivers" << std::endl;
+	std::cout << "  -k Directory to cache quiver layouts in" << std::endl;
+	std::cout << "  -K Size limit of the layout cache in megabytes" << std::endl;
+}
+
+/* Read a whole number from 1 up to max, returning false for anything else. */
+bool parse_number(const char* str, size_t& result, size_t max = SIZE_MAX) {
+	if(str[0] == '-') {
+		return false;
+	}
+	try {
+		size_t used = 0;
+		result = std::stoul(str, &used);
+		return used > 0 && str[used] == '\0' && result >= 1 && result <= max;
+	} catch(const std::logic_error&) {
+		return false;
+	}
+}
+
+int main(int argc, char* argv[]) {
+	qvdraw::trace::init(argc, argv);
+	qvdraw::batch::Options opts;
+	std::string cache_dir;
+	size_t cache_bytes = qvlayout::LayoutCache::DEFAULT_MAX_BYTES;
+	size_t number;
+	int c;
+
+	while((c = getopt(argc, argv, "d:f:s:j:t:w:nk:K:h")) != -1) {
+		switch(c) {
+			case 'd':
+				opts.directory = optarg;
+				break;
+			case 'f':
+				if(!parse_number(optarg, opts.first)) {
+					usage();
+					return 1;
+				}
+				break;
+			case 's':
+				if(!parse_number(optarg, number, INT_MAX)) {
+					usage();
+					return 1;
+				}
+				opts.size = number;
+				break;
+			case 'j':
+				if(!parse_number(optarg, opts.jobs)) {
+					usage();
+					return 1;
+				}
+				break;
+			case 't':
+				try {
+					opts.format = qvdraw::render::format(optarg);
+				} catch(const std::invalid_argument& e) {
+					std::cerr << e.what() << std::endl;
+					return 1;
+				}
+				break;
+			case 'w':
+				if(!parse_number(optarg, number, INT_MAX)) {
+					usage();
+					return 1;
+				}
+				opts.style.width = number;
+				break;
+			case 'n':
+				opts.style.arrows = false;
+				break;
+			case 'k':
+				cache_dir = optarg;
+				break;
+			case 'K':
+				if(!parse_number(optarg, cache_bytes, SIZE_MAX / (1024 * 1024))) {
+					usage();
+					return 1;
+				}
+				cache_bytes *= 1024 * 1024;
+				break;
+			case 'h':
+				usage();
+				return 0;
+			case '?':
+				usage();
+				return 1;
+			default:
+				usage();
+				return 2;
+		}
+	}
+	std::unique_ptr<qvlayout::LayoutCache> cache;
+	if(!cache_dir.empty()) {
+		cache.reset(new qvlayout::LayoutCache(cache_dir, cache_bytes));
+		opts.cache = cache.get();
+	}
+	qvdraw::batch::Summary summary;
+	if(optind < argc) {
+		std::ifstream file(argv[optind]);
+		if(!file) {
+			std::cerr << "Could not load " << argv[optind] << std::endl;
+			return 1;
+		}
+		summary = qvdraw::batch::run(file, opts);
+	} else {
+		summary = qvdraw::batch::run(std::cin, opts);
+	}
+	if(cache) {
+		cache->report(std::cerr);
+	}
+	if(summary.failed > 0) {
+		std::cerr << summary.failed << " of " << summary.written + summary.failed
+			<< " quivers could not be drawn" << std::endl;
+		return 3;
+	}
+	return 0;
+}
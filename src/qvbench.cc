@@ -0,0 +1,584 @@
+/*
+ * qvbench.cc
+ * Copyright 2014-2015 John Lawson
+ *
+ * This program is free software: you can redistribute it and/or modify
+ * it under the terms of the GNU General Public License as published by
+ * the Free Software Foundation, either version 3 of the License, or
+ * (at your option) any later version.
+ *
+ * This program is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ * GNU General Public License for more details.
+ *
+ * You should have received a copy of the GNU General Public License
+ * along with this program.  If not, see <http://www.gnu.org/licenses/>.
+ */
+/**
+ * Time each stage of drawing a graph on a fixed set of inputs, and write the
+ * results as JSON so that runs of different builds can be compared.
+ *
+ * The inputs are Dynkin quivers of increasing rank, the quiver mutation
+ * classes and MMI move graphs of some of them, exchange graphs of symbolic
+ * seeds, and labelled exchange graphs from both symbolic and g-vector seeds.
+ * The TeX output is also timed on made up graphs of up to a million vertices,
+ * with every vertex of degree four and some vertices left unexplored.
+ *
+ * Each measurement is repeated until it has taken at least the minimum time,
+ * and the mean time of one run is reported along with the number of items,
+ * such as vertices and edges, it handled.
+ */
+#include <unistd.h>
+
+#include <chrono>
+#include <deque>
+#include <fstream>
+#include <iostream>
+#include <random>
+#include <string>
+#include <unordered_map>
+#include <vector>
+
+#include "ogdf/basic/Graph.h"
+#include "ogdf/basic/GraphAttributes.h"
+
+#include "qv/equiv_quiver_matrix.h"
+#include "qv/ginac_util.h"
+#include "qv/move_graph.h"
+#include "qv/seed.h"
+#include "qv/template_exchange_graph.h"
+
+#include "consts.h"
+#include "explore.h"
+#include "gml.h"
+#include "graph_factory.h"
+#include "gvector_seed.h"
+#include "layout.h"
+#include "layout_cache.h"
+#include "move_index.h"
+#include "tex.h"
+#include "trace.h"
+
+namespace {
+typedef std::chrono::steady_clock Clock;
+/* Limit on the size of the explored graphs, so that no input runs away. */
+const size_t LIMIT = 5000;
+/* Every hundredth vertex is unexplored, as at the edge of a truncated graph. */
+const int REMOVED_EVERY = 100;
+struct Result {
+	std::string stage;
+	std::string input;
+	size_t runs;
+	size_t items;
+	double seconds;
+};
+
+class Bench {
+public:
+	explicit Bench(double min_seconds) : min_seconds_(min_seconds) {}
+	/*
+	 * Time f, which returns the number of items it handled, running it again
+	 * until at least the minimum time has passed.
+	 */
+	template <class F>
+	void measure(const std::string& stage, const std::string& input, F&& f) {
+		run(stage, input, f, min_seconds_);
+	}
+	/* Time f once, for work which is only done the first time. */
+	template <class F>
+	void once(const std::string& stage, const std::string& input, F&& f) {
+		run(stage, input, f, 0);
+	}
+	void write(std::ostream& os) const;
+
+private:
+	const double min_seconds_;
+	std::vector<Result> results_;
+	template <class F>
+	void run(const std::string& stage, const std::string& input, F& f,
+			double min_seconds) {
+		size_t runs = 0;
+		size_t items = 0;
+		double elapsed = 0;
+		const Clock::time_point start = Clock::now();
+		do {
+			items = f();
+			++runs;
+			elapsed = std::chrono::duration<double>(Clock::now() - start).count();
+		} while(elapsed < min_seconds);
+		results_.push_back(Result{stage, input, runs, items, elapsed / runs});
+		std::cerr << stage << ' ' << input << ": " << elapsed / runs << "s"
+				<< std::cerr.widen('\n');
+	}
+};
+
+/* The names are all plain text, but quote anything JSON needs quoted. */
+std::string json_string(const std::string& str) {
+	std::string result = "\"";
+	for(char c : str) {
+		if(c == '"' || c == '\\') {
+			result += '\\';
+		}
+		result += c;
+	}
+	return result + '"';
+}
+
+void Bench::write(std::ostream& os) const {
+	os << "{\n  \"min_seconds\": " << min_seconds_ << ",\n  \"results\": [";
+	for(size_t i = 0; i < results_.size(); ++i) {
+		const Result& r = results_[i];
+		os << (i == 0 ? "\n" : ",\n") << "    {\"stage\": "
+				<< json_string(r.stage) << ", \"input\": " << json_string(r.input)
+				<< ", \"runs\": " << r.runs << ", \"items\": " << r.items
+				<< ", \"seconds\": " << r.seconds << "}";
+	}
+	os << "\n  ]\n}\n";
+}
+
+/* Matrix of the Dynkin diagram, with every arrow pointing from the lower
+ * numbered vertex, so the quiver is acyclic. */
+std::string dynkin(char type, int rank) {
+	std::vector<std::pair<int, int>> arrows;
+	const int line = type == 'A' ? rank : rank - 1;
+	for(int i = 0; i + 1 < line; ++i) {
+		arrows.emplace_back(i, i + 1);
+	}
+	if(type == 'D') {
+		arrows.emplace_back(rank - 3, rank - 1);
+	} else if(type == 'E') {
+		arrows.emplace_back(2, rank - 1);
+	}
+	std::vector<int> entries(rank * rank, 0);
+	for(const auto& arrow : arrows) {
+		entries[arrow.first * rank + arrow.second] = 1;
+		entries[arrow.second * rank + arrow.first] = -1;
+	}
+	std::string result = "{ ";
+	for(int i = 0; i < rank; ++i) {
+		result += "{ ";
+		for(int j = 0; j < rank; ++j) {
+			result += std::to_string(entries[i * rank + j]) + " ";
+		}
+		result += "} ";
+	}
+	return result + "}";
+}
+
+cluster::Seed::Cluster default_cluster(size_t size) {
+	cluster::Seed::Cluster result(size);
+	std::string var = "x_";
+	for(size_t i = 0; i < size; ++i) {
+		result[i] = cluster::ginac::symbol(var + std::to_string(i));
+	}
+	return result;
+}
+
+const char* method_name(qvlayout::Method method) {
+	switch(method) {
+		case qvlayout::Method::Energy:
+			return "energy";
+		case qvlayout::Method::Hierachy:
+			return "hierarchy";
+		case qvlayout::Method::Layered:
+			return "layered";
+		case qvlayout::Method::Visibility:
+			return "visibility";
+		case qvlayout::Method::Dominance:
+			return "dominance";
+		case qvlayout::Method::Balloon:
+			return "balloon";
+		case qvlayout::Method::Auto:
+			return "auto";
+	}
+	return "unknown";
+}
+
+struct AllBlack {
+	template <class M>
+	const char* vertex_colour(const M* /* ignored */) const {
+		return "black";
+	}
+	template <class M>
+	const char* edge_colour(const M* /* ignored */,
+			const M* /* ignored */) const {
+		return "black";
+	}
+};
+
+struct NoLabel {
+	template <class M>
+	bool has_label(const M* /* ignored */) const {
+		return false;
+	}
+	template <class M>
+	const char* label(const M* /* ignored */) const {
+		return "";
+	}
+};
+
+/* Explored graph, kept to lay out and write in the later stages. */
+struct Explored {
+	std::string name;
+	ogdf::Graph graph;
+	size_t size;
+};
+
+/* Explore the graph from the initial vertex into an ogdf::Graph. */
+template <class M, class Step>
+size_t explore_into(const M& initial, const Step& step, ogdf::Graph& graph) {
+	graph.clear();
+	qvdraw::explore::GraphBuilder builder(graph);
+	qvdraw::explore::explore(initial, step, builder, LIMIT);
+	return graph.numberOfNodes() + graph.numberOfEdges();
+}
+
+/* Graph which looks like a large exchange graph, for the TeX output. */
+void made_up_graph(int size, ogdf::Graph& graph) {
+	std::vector<ogdf::node> nodes(size);
+	for(int i = 0; i < size; ++i) {
+		nodes[i] = graph.newNode();
+	}
+	int stride = size > 10 ? size / 10 : 1;
+	for(int i = 0; i < size; ++i) {
+		graph.newEdge(nodes[i], nodes[(i + 1) % size]);
+		graph.newEdge(nodes[i], nodes[(i + stride) % size]);
+	}
+}
+
+/* Scatter the vertices at random, the same way each time. */
+void made_up_layout(int size, const ogdf::Graph& graph,
+		ogdf::GraphAttributes& attr) {
+	std::mt19937 gen(size);
+	std::uniform_real_distribution<double> coord(-1e4, 1e4);
+	ogdf::node n;
+	forall_nodes(n, graph) {
+		attr.x(n) = coord(gen);
+		attr.y(n) = coord(gen);
+	}
+}
+
+/* Write the TikZ picture of the graph, with every vertex drawn. */
+size_t write_tex(std::ostream& os, const ogdf::Graph& graph,
+		const ogdf::GraphAttributes& attr, int removed_every) {
+	const int vertex = 0;
+	std::vector<const int*> table(graph.maxNodeIndex() + 1, &vertex);
+	if(removed_every > 0) {
+		for(size_t i = 0; i < table.size(); i += removed_every) {
+			table[i] = nullptr;
+		}
+	}
+	const AllBlack colouring{};
+	NoLabel labelling;
+	{
+		qv2tex::TexBuffer out(os);
+		qv2tex::draw_graph(out, graph, attr, table, colouring, labelling);
+	}
+	os.flush();
+	return graph.numberOfNodes() + graph.numberOfEdges();
+}
+
+std::vector<std::pair<size_t, size_t>> edge_list(const ogdf::Graph& graph) {
+	std::vector<std::pair<size_t, size_t>> edges;
+	edges.reserve(graph.numberOfEdges());
+	ogdf::edge e;
+	forall_edges(e, graph) {
+		edges.emplace_back(e->source()->index(), e->target()->index());
+	}
+	return edges;
+}
+}
+
+void usage() {
+	std::cout << "qvbench [-o file] [-t seconds] [-m moves] [size ...]"
+			<< std::endl;
+	std::cout << "Time each stage of drawing graphs on a fixed set of inputs."
+			<< std::endl;
+	std::cout << "  -o File to write the JSON results to. Default is stdout"
+			<< std::endl;
+	std::cout << "  -t Minimum time to spend on each measurement. Default is 0.2"
+			<< std::endl;
+	std::cout << "  -m Text file of moves to time the loading of" << std::endl;
+	std::cout << "  size Numbers of vertices of the made up graphs written as TeX"
+			<< std::endl;
+}
+
+int main(int argc, char* argv[]) {
+	qvdraw::trace::init(argc, argv);
+	std::string output;
+	std::string moves_file;
+	double min_seconds = 0.2;
+	int c;
+	while((c = getopt(argc, argv, "o:t:m:h")) != -1) {
+		switch(c) {
+			case 'o':
+				output = optarg;
+				break;
+			case 't':
+				min_seconds = std::stod(optarg);
+				break;
+			case 'm':
+				moves_file = optarg;
+				break;
+			case 'h':
+				usage();
+				return 0;
+			default:
+				usage();
+				return 1;
+		}
+	}
+	std::vector<int> sizes;
+	for(int i = optind; i < argc; ++i) {
+		sizes.push_back(std::stoi(argv[i]));
+	}
+	if(sizes.empty()) {
+		sizes = {1000, 10000, 100000, 1000000};
+	}
+	std::ofstream null_out("/dev/null", std::ios::binary);
+	Bench bench(min_seconds);
+	typedef cluster::EquivQuiverMatrix EquivM;
+
+	/* The moves are built the first time they are used, so this has to come
+	 * before anything else which uses them. */
+	bench.once("moves", "table",
+			[]() { return qvdraw::consts::moves().size(); });
+	bench.once("patterns", "table",
+			[]() { return qvdraw::consts::patterns().size(); });
+	if(!moves_file.empty()) {
+		bench.measure("load_moves", moves_file, [&moves_file]() {
+			return qvdraw::consts::load_moves(moves_file).size();
+		});
+	}
+
+	const std::vector<std::pair<char, int>> dynkins = {
+		{'A', 4}, {'A', 8}, {'A', 16}, {'A', 32}, {'D', 4}, {'D', 8},
+		{'D', 16}, {'D', 32}, {'E', 6}, {'E', 7}, {'E', 8}};
+	auto name = [](char type, int rank) {
+		return std::string(1, type) + std::to_string(rank);
+	};
+	for(const auto& d : dynkins) {
+		const std::string str = dynkin(d.first, d.second);
+		bench.measure("parse", name(d.first, d.second), [&str]() {
+			cluster::IntMatrix matrix(str);
+			return static_cast<size_t>(matrix.num_rows());
+		});
+	}
+
+	/* Quiver mutation classes, MMI move graphs, exchange graphs and labelled
+	 * exchange graphs, with both symbolic and g-vector seeds. */
+	std::deque<Explored> graphs;
+	const std::vector<std::pair<char, int>> classes = {
+		{'A', 4}, {'A', 6}, {'D', 5}, {'D', 6}, {'E', 6}, {'E', 7}};
+	for(const auto& d : classes) {
+		const EquivM matrix(dynkin(d.first, d.second));
+		qvdraw::explore::MutationStep<EquivM> step;
+		graphs.emplace_back();
+		Explored& explored = graphs.back();
+		explored.name = "quivers " + name(d.first, d.second);
+		bench.measure("explore", explored.name, [&]() {
+			return explore_into(matrix, step, explored.graph);
+		});
+	}
+	const qvdraw::MoveIndex index(qvdraw::consts::patterns());
+	for(const auto& d : classes) {
+		const EquivM matrix(dynkin(d.first, d.second));
+		qvdraw::explore::MoveStep<EquivM> step(qvdraw::consts::moves(), &index);
+		graphs.emplace_back();
+		Explored& explored = graphs.back();
+		explored.name = "moves " + name(d.first, d.second);
+		bench.measure("explore", explored.name, [&]() {
+			return explore_into(matrix, step, explored.graph);
+		});
+	}
+	for(int rank : {3, 4}) {
+		const cluster::QuiverMatrix matrix(dynkin('A', rank));
+		const cluster::Seed seed(matrix, default_cluster(rank));
+		qvdraw::explore::MutationStep<cluster::Seed> step;
+		graphs.emplace_back();
+		Explored& explored = graphs.back();
+		explored.name = "seeds " + name('A', rank);
+		bench.measure("explore", explored.name, [&]() {
+			return explore_into(seed, step, explored.graph);
+		});
+	}
+	for(int rank : {3, 4}) {
+		const cluster::QuiverMatrix matrix(dynkin('A', rank));
+		const cluster::LabelledSeed seed(matrix, default_cluster(rank));
+		qvdraw::explore::MutationStep<cluster::LabelledSeed> step;
+		graphs.emplace_back();
+		Explored& explored = graphs.back();
+		explored.name = "labelled seeds " + name('A', rank);
+		bench.measure("explore", explored.name, [&]() {
+			return explore_into(seed, step, explored.graph);
+		});
+	}
+	for(int rank : {3, 4}) {
+		const cluster::QuiverMatrix matrix(dynkin('A', rank));
+		const qvdraw::GVectorSeed seed(matrix, true);
+		qvdraw::explore::MutationStep<qvdraw::GVectorSeed> step;
+		graphs.emplace_back();
+		Explored& explored = graphs.back();
+		explored.name = "labelled g-vector seeds " + name('A', rank);
+		bench.measure("explore", explored.name, [&]() {
+			return explore_into(seed, step, explored.graph);
+		});
+	}
+	for(Explored& explored : graphs) {
+		explored.size =
+				explored.graph.numberOfNodes() + explored.graph.numberOfEdges();
+	}
+
+	/* Looking up every seed of the exchange graph, as qv2tex -e does for each
+	 * neighbour, with the fingerprints of the cluster variables worked out on
+	 * every hash and comparison, and with them kept in the keys of the map. */
+	{
+		typedef const cluster::Seed* SeedPtr;
+		const cluster::QuiverMatrix matrix(dynkin('A', 4));
+		const cluster::Seed seed(matrix, default_cluster(4));
+		qvdraw::explore::MutationStep<cluster::Seed> step;
+		ogdf::Graph graph;
+		qvdraw::explore::GraphBuilder builder(graph);
+		const std::deque<cluster::Seed> seeds =
+				qvdraw::explore::explore(seed, step, builder, LIMIT);
+		bench.measure("seed_lookup", "uncached A4", [&seeds]() {
+			std::unordered_map<SeedPtr, size_t, qvdraw::NodeHash<SeedPtr>,
+					qvdraw::NodeEquals<SeedPtr>> ids;
+			for(const cluster::Seed& s : seeds) {
+				ids.emplace(&s, ids.size());
+			}
+			size_t found = 0;
+			for(const cluster::Seed& s : seeds) {
+				found += ids.count(&s);
+			}
+			return found;
+		});
+		bench.measure("seed_lookup", "cached A4", [&seeds]() {
+			qvdraw::NodeKeyMap<SeedPtr, size_t> ids;
+			for(const cluster::Seed& s : seeds) {
+				ids.emplace(qvdraw::NodeKey<SeedPtr>(&s), ids.size());
+			}
+			size_t found = 0;
+			for(const cluster::Seed& s : seeds) {
+				found += ids.count(qvdraw::NodeKey<SeedPtr>(&s));
+			}
+			return found;
+		});
+	}
+
+	/* Conversion of the libqv graphs, which are built first and not timed. */
+	{
+		const EquivM matrix(dynkin('D', 6));
+		cluster::QuiverGraph graph(matrix, matrix.num_rows(), LIMIT);
+		bench.measure("multi_graph", "quivers D6", [&graph]() {
+			auto pair = qvdraw::graph_factory::multi_graph<const EquivM>(graph);
+			return static_cast<size_t>(pair.first.numberOfNodes() +
+					pair.first.numberOfEdges());
+		});
+	}
+	{
+		const EquivM matrix(dynkin('E', 6));
+		cluster::MoveGraph<EquivM> graph(matrix, qvdraw::consts::moves());
+		bench.measure("multi_graph", "moves E6", [&graph]() {
+			auto pair = qvdraw::graph_factory::multi_graph<const EquivM>(graph);
+			return static_cast<size_t>(pair.first.numberOfNodes() +
+					pair.first.numberOfEdges());
+		});
+	}
+	{
+		const cluster::QuiverMatrix matrix(dynkin('A', 3));
+		const cluster::LabelledSeed seed(matrix, default_cluster(3));
+		cluster::LabelledExchangeGraph graph(seed, seed.size(), LIMIT);
+		bench.measure("multi_graph", "labelled seeds A3", [&graph]() {
+			auto pair = qvdraw::graph_factory::multi_graph<const cluster::LabelledSeed>(graph);
+			return static_cast<size_t>(pair.first.numberOfNodes() +
+					pair.first.numberOfEdges());
+		});
+	}
+
+	/* Every method on the Dynkin quivers, which are acyclic as the upward
+	 * methods need, and the general methods on the explored graphs. */
+	const std::vector<qvlayout::Method> all_methods = {
+		qvlayout::Method::Energy, qvlayout::Method::Hierachy,
+		qvlayout::Method::Layered, qvlayout::Method::Visibility,
+		qvlayout::Method::Dominance, qvlayout::Method::Balloon,
+		qvlayout::Method::Auto};
+	const std::vector<qvlayout::Method> graph_methods = {
+		qvlayout::Method::Energy, qvlayout::Method::Layered,
+		qvlayout::Method::Balloon, qvlayout::Method::Auto};
+	for(const auto& d : dynkins) {
+		const cluster::IntMatrix matrix(dynkin(d.first, d.second));
+		auto pair = qvdraw::graph_factory::graph(matrix);
+		ogdf::Graph& graph = *pair.first;
+		const size_t items = graph.numberOfNodes() + graph.numberOfEdges();
+		for(qvlayout::Method method : all_methods) {
+			bench.measure(std::string("layout/") + method_name(method),
+					name(d.first, d.second), [&]() {
+				ogdf::GraphAttributes attr(graph);
+				qvlayout::layout(graph, attr, 10, method);
+				return items;
+			});
+		}
+		bench.measure("layout/dynkin", name(d.first, d.second), [&]() {
+			ogdf::GraphAttributes attr(graph);
+			qvlayout::layout(matrix, graph, attr, 10, qvlayout::Method::Energy,
+					nullptr);
+			return items;
+		});
+	}
+	for(Explored& explored : graphs) {
+		for(qvlayout::Method method : graph_methods) {
+			bench.measure(std::string("layout/") + method_name(method),
+					explored.name, [&]() {
+				ogdf::GraphAttributes attr(explored.graph);
+				qvlayout::layout(explored.graph, attr, 10, method);
+				return explored.size;
+			});
+		}
+	}
+
+	for(const auto& d : dynkins) {
+		const cluster::IntMatrix matrix(dynkin(d.first, d.second));
+		bench.measure("emit/gml", name(d.first, d.second), [&]() {
+			qvdraw::gml::write(null_out, matrix);
+			null_out.flush();
+			return static_cast<size_t>(matrix.num_rows());
+		});
+	}
+	for(Explored& explored : graphs) {
+		const std::vector<std::pair<size_t, size_t>> edges =
+				edge_list(explored.graph);
+		bench.measure("emit/gml", explored.name, [&]() {
+			qvdraw::gml::write(null_out, explored.graph.numberOfNodes(), edges);
+			null_out.flush();
+			return explored.size;
+		});
+		ogdf::GraphAttributes attr(explored.graph);
+		qvlayout::layout(explored.graph, attr, 10, qvlayout::Method::Energy);
+		bench.measure("emit/tex", explored.name, [&]() {
+			return write_tex(null_out, explored.graph, attr, 0);
+		});
+	}
+	for(int size : sizes) {
+		ogdf::Graph graph;
+		made_up_graph(size, graph);
+		ogdf::GraphAttributes attr(graph);
+		made_up_layout(size, graph, attr);
+		bench.measure("emit/tex", "made up " + std::to_string(size), [&]() {
+			return write_tex(null_out, graph, attr, REMOVED_EVERY);
+		});
+	}
+
+	if(output.empty()) {
+		bench.write(std::cout);
+	} else {
+		std::ofstream file(output);
+		bench.write(file);
+		if(!file) {
+			std::cerr << "Could not write " << output << std::cerr.widen('\n');
+			return 1;
+		}
+	}
+	return 0;
+}
@@ -20,38 +20,117 @@
  */
 #include <unistd.h>
 
+#include <cstdint>
+#include <stdexcept>
 #include <string>
 
 #include "qv/template_exchange_graph.h"
 
 #include "consts.h"
+#include "csr_graph.h"
+#include "explore.h"
+#include "gml.h"
 #include "graph_factory.h"
+#include "parallel_explore.h"
+#include "trace.h"
 
 void usage() {
-	std::cout << "qvgraph2gml -m matrix" << std::endl;
+	std::cout << "qvgraph2gml [-l] [-j jobs] [-s [-t format]] -m matrix" << std::endl;
+	std::cout << "  -l Compute the labelled quiver graph" << std::endl;
+	std::cout << "  -j Number of threads used to explore the graph, only with -l and without -s" << std::endl;
+	std::cout << "  -s Write each node and edge as soon as it is found" << std::endl;
+	std::cout << "  -t Output format, one of gml, graphml or qvb, or gml or edges with -s" << std::endl;
 }
 
-cluster::QuiverMatrix get_matrix(const std::string& matrix) {
-	return cluster::QuiverMatrix(matrix);
+template <class M>
+void write(const qvdraw::CsrGraph<M>& csr, const std::string& format) {
+	if(format == "qvb") {
+		qvdraw::binary(csr).write(std::cout);
+	} else {
+		qvdraw::gml::write(std::cout, csr.size(), csr.edges(),
+				format == "graphml" ? qvdraw::gml::Format::GraphML
+				: qvdraw::gml::Format::GML);
+	}
 }
 
-void output_gml(const cluster::QuiverGraph& mat) {
+void output_gml(const cluster::QuiverGraph& mat, const std::string& format) {
 	typedef const cluster::EquivQuiverMatrix M;
-	qvdraw::GraphPair<M> g = qvdraw::graph_factory::multi_graph<M>(mat);
-	g.first.writeGML(std::cout);
+	write(qvdraw::CsrGraph<M>(mat), format);
+}
+
+template <class M>
+void output_gml(const qvdraw::explore::ExploredGraph<M>& mat,
+		const std::string& format) {
+	write(qvdraw::CsrGraph<const M>(mat), format);
+}
+
+template <class M, class Step, class Writer>
+void stream(const M& mat, const Step& step, Writer& writer) {
+	qvdraw::explore::explore(mat, step, writer);
+	writer.end();
+}
+
+template <class M>
+void run(const std::string& str, bool streaming, const std::string& format,
+		size_t jobs) {
+	M mat(str);
+	qvdraw::explore::MutationStep<M> step;
+	if(streaming && format == "edges") {
+		qvdraw::explore::EdgeListWriter writer(std::cout);
+		stream(mat, step, writer);
+	} else if(streaming) {
+		qvdraw::explore::GmlWriter writer(std::cout);
+		stream(mat, step, writer);
+	} else {
+		output_gml(qvdraw::explore::parallel_explore(mat, step, jobs), format);
+	}
+}
+
+/* Read a whole number from 1 up to max, returning false for anything else. */
+bool parse_number(const char* str, size_t& result, size_t max = SIZE_MAX) {
+	if(str[0] == '-') {
+		return false;
+	}
+	try {
+		size_t used = 0;
+		result = std::stoul(str, &used);
+		return used > 0 && str[used] == '\0' && result >= 1 && result <= max;
+	} catch(const std::logic_error&) {
+		return false;
+	}
 }
 
 int main(int argc, char* argv[]) {
+	qvdraw::trace::init(argc, argv);
 	bool matrix = false;
+	bool labelled = false;
+	bool streaming = false;
+	size_t jobs = 1;
+	std::string format = "gml";
 	std::string str;
 	int c;
 
-	while( (c=getopt(argc, argv, "m:")) != -1) {
+	while( (c=getopt(argc, argv, "m:lj:st:")) != -1) {
 		switch(c) {
 			case 'm':
 				matrix = true;
 				str = optarg;
 				break;
+			case 'l':
+				labelled = true;
+				break;
+			case 'j':
+				if(!parse_number(optarg, jobs)) {
+					usage();
+					return 1;
+				}
+				break;
+			case 's':
+				streaming = true;
+				break;
+			case 't':
+				format = optarg;
+				break;
 			case '?':
 				usage();
 				return 1;
@@ -60,15 +139,30 @@ int main(int argc, char* argv[]) {
 				return 2;
 		}
 	}
-	if(!matrix) {
+	bool valid_format = format == "gml" ||
+		(streaming ? format == "edges"
+			: format == "graphml" || format == "qvb");
+	if(!matrix || !valid_format) {
 		usage();
 		return 1;
 	}
-	typedef cluster::EquivQuiverMatrix Matrix;
-	typedef cluster::QuiverGraph Graph;
-	Matrix mat = get_matrix(str);
-	Graph graph(mat, mat.num_rows());
-	output_gml(graph);
+	/* libqv cannot compare unlabelled quivers on more than one thread, and a
+	 * streamed graph is always explored on a single thread. */
+	if(jobs > 1 && (!labelled || streaming)) {
+		std::cerr << "-j can only be used with -l and without -s" << std::endl;
+		usage();
+		return 1;
+	}
+	if(labelled) {
+		run<cluster::QuiverMatrix>(str, streaming, format, jobs);
+	} else if(streaming) {
+		run<cluster::EquivQuiverMatrix>(str, streaming, format, jobs);
+	} else {
+		typedef cluster::EquivQuiverMatrix Matrix;
+		typedef cluster::QuiverGraph Graph;
+		Matrix mat(str);
+		Graph graph(mat, mat.num_rows());
+		output_gml(graph, format);
+	}
 	return 0;
 }
-
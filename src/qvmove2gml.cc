@@ -20,38 +20,80 @@
  */
 #include <unistd.h>
 
+#include <stdexcept>
 #include <string>
-
-#include "qv/move_graph.h"
+#include <vector>
 
 #include "consts.h"
+#include "csr_graph.h"
+#include "explore.h"
+#include "gml.h"
 #include "graph_factory.h"
+#include "move_index.h"
+#include "parallel_explore.h"
+#include "trace.h"
 
 void usage() {
-	std::cout << "qvmove2gml -m matrix" << std::endl;
+	std::cout << "qvmove2gml [-s [-t format]] [-M moves] -m matrix" << std::endl;
+	std::cout << "  -s Write each node and edge as soon as it is found" << std::endl;
+	std::cout << "  -t Output format, one of gml, graphml or qvb, or gml or edges with -s" << std::endl;
+	std::cout << "  -M File of extra moves to use as well as the usual ones" << std::endl;
 }
 
 cluster::QuiverMatrix get_matrix(const std::string& matrix) {
 	return cluster::QuiverMatrix(matrix);
 }
 
-void output_gml(const cluster::MoveGraph<cluster::EquivQuiverMatrix>& mat) {
+void output_gml(
+		const qvdraw::explore::ExploredGraph<cluster::EquivQuiverMatrix>& mat,
+		const std::string& format) {
 	typedef const cluster::EquivQuiverMatrix M;
-	qvdraw::GraphPair<M> g = qvdraw::graph_factory::multi_graph<M>(mat);
-	g.first.writeGML(std::cout);
+	qvdraw::CsrGraph<M> csr(mat);
+	if(format == "qvb") {
+		qvdraw::binary(csr).write(std::cout);
+		return;
+	}
+	qvdraw::gml::write(std::cout, csr.size(), csr.edges(),
+			format == "graphml" ? qvdraw::gml::Format::GraphML
+			: qvdraw::gml::Format::GML);
+}
+
+template <class Writer>
+void stream(const cluster::EquivQuiverMatrix& mat,
+		const std::vector<cluster::MMIMove>& moves,
+		const std::vector<qvdraw::consts::MovePatterns>& patterns,
+		Writer& writer) {
+	typedef cluster::EquivQuiverMatrix M;
+	qvdraw::MoveIndex index(patterns);
+	qvdraw::explore::MoveStep<M> step(moves, &index);
+	qvdraw::explore::explore(mat, step, writer);
+	writer.end();
 }
 
 int main(int argc, char* argv[]) {
+	qvdraw::trace::init(argc, argv);
 	bool matrix = false;
+	bool streaming = false;
+	std::string format = "gml";
 	std::string str;
+	std::string extra;
 	int c;
 
-	while( (c=getopt(argc, argv, "m:")) != -1) {
+	while( (c=getopt(argc, argv, "m:st:M:")) != -1) {
 		switch(c) {
 			case 'm':
 				matrix = true;
 				str = optarg;
 				break;
+			case 's':
+				streaming = true;
+				break;
+			case 't':
+				format = optarg;
+				break;
+			case 'M':
+				extra = optarg;
+				break;
 			case '?':
 				usage();
 				return 1;
@@ -60,15 +102,42 @@ int main(int argc, char* argv[]) {
 				return 2;
 		}
 	}
-	if(!matrix) {
+	bool valid_format = format == "gml" ||
+		(streaming ? format == "edges"
+			: format == "graphml" || format == "qvb");
+	if(!matrix || !valid_format) {
 		usage();
 		return 1;
 	}
 	typedef cluster::EquivQuiverMatrix Matrix;
-	typedef cluster::MoveGraph<Matrix> Move;
 	Matrix mat = get_matrix(str);
-	Move move_graph(mat,qvdraw::consts::Moves);
-	output_gml(move_graph);
+	std::vector<cluster::MMIMove> moves = qvdraw::consts::moves();
+	std::vector<qvdraw::consts::MovePatterns> patterns =
+		qvdraw::consts::patterns();
+	if(!extra.empty()) {
+		try {
+			std::vector<cluster::MMIMove> more =
+				qvdraw::consts::load_moves(extra, &patterns);
+			moves.insert(moves.end(), more.begin(), more.end());
+		} catch(const std::runtime_error& e) {
+			std::cerr << e.what() << std::endl;
+			return 1;
+		}
+	}
+	if(streaming && format == "edges") {
+		qvdraw::explore::EdgeListWriter writer(std::cout);
+		stream(mat, moves, patterns, writer);
+		return 0;
+	} else if(streaming) {
+		qvdraw::explore::GmlWriter writer(std::cout);
+		stream(mat, moves, patterns, writer);
+		return 0;
+	}
+	/* The move index cannot be shared between threads, and unlabelled quivers
+	 * are only compared on one thread anyway. */
+	qvdraw::MoveIndex index(patterns);
+	qvdraw::explore::MoveStep<Matrix> step(moves, &index);
+	output_gml(qvdraw::explore::parallel_explore(mat, step, 1), format);
 	return 0;
 }
 
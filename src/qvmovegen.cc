@@ -0,0 +1,121 @@
+/*
+ * qvmovegen.cc
+ * Copyright 2014-2015 John Lawson
+ *
+ * This program is free software: you can redistribute it and/or modify
+ * it under the terms of the GNU General Public License as published by
+ * the Free Software Foundation, either version 3 of the License, or
+ * (at your option) any later version.
+ *
+ * This program is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ * GNU General Public License for more details.
+ *
+ * You should have received a copy of the GNU General Public License
+ * along with this program.  If not, see <http://www.gnu.org/licenses/>.
+ */
+/**
+ * Writes the C++ source of the compiled move table from the text definitions
+ * of the moves. The build runs this on data/moves.txt and checks the output
+ * is the same as src/move_table.cc, so the two cannot drift apart.
+ */
+#include <fstream>
+#include <iostream>
+#include <stdexcept>
+#include <string>
+
+#include "move_table.h"
+#include "trace.h"
+
+namespace {
+const char* const REQ_NAMES[] = {"Req::Unconnected", "Req::Line",
+                                 "Req::ConnectedTo", "Req::LineTo"};
+template <class T, class F>
+void write_array(std::ostream& os, const char* type, const std::string& name,
+                 const std::vector<T>& values, F&& format) {
+  os << "constexpr " << type << ' ' << name << "[] = {";
+  for (size_t i = 0; i < values.size(); ++i) {
+    os << (i == 0 ? "" : ", ") << format(values[i]);
+  }
+  os << "};\n";
+}
+int as_is(int value) {
+  return value;
+}
+/* Writes the entries of the matrix if there is one, and returns the
+ * initialiser of its MatrixRecord. */
+std::string write_matrix(std::ostream& os, const std::string& name,
+                         const qvdraw::consts::MoveDefinition::Matrix& m) {
+  if (m.rows == 0) {
+    return "{0, 0, nullptr}";
+  }
+  write_array(os, "int", name, m.entries, as_is);
+  return "{" + std::to_string(m.rows) + ", " + std::to_string(m.cols) + ", " +
+         name + "}";
+}
+void generate(std::ostream& os,
+              const std::vector<qvdraw::consts::MoveDefinition>& moves,
+              const std::string& source) {
+  os << "/* Generated by qvmovegen from " << source
+     << ". Do not edit, run make moves instead. */\n";
+  os << "#include \"move_table.h\"\n\n";
+  os << "namespace qvdraw {\nnamespace consts {\nnamespace {\n";
+  std::vector<std::string> records;
+  for (size_t i = 0; i < moves.size(); ++i) {
+    const qvdraw::consts::MoveDefinition& move = moves[i];
+    const std::string n = std::to_string(i);
+    os << "/* Line " << move.line << " */\n";
+    std::string record = "{" + write_matrix(os, "a" + n, move.a) + ", ";
+    record += write_matrix(os, "b" + n, move.b) + ", ";
+    record += std::to_string(move.conn.size()) + ", ";
+    if (move.conn.empty()) {
+      record += "nullptr, nullptr, nullptr, ";
+    } else {
+      write_array(os, "int", "conn" + n, move.conn, as_is);
+      write_array(os, "Req", "reqs" + n, move.reqs,
+                  [](qvdraw::consts::Req r) {
+                    return REQ_NAMES[static_cast<int>(r)];
+                  });
+      write_array(os, "int", "args" + n, move.req_args, as_is);
+      record += "conn" + n + ", reqs" + n + ", args" + n + ", ";
+    }
+    record += write_matrix(os, "atob" + n, move.atob) + ", ";
+    record += write_matrix(os, "btoa" + n, move.btoa) + "}";
+    records.push_back(record);
+  }
+  os << "}\n";
+  os << "constexpr MoveRecord MOVE_TABLE[] = {\n";
+  for (const std::string& record : records) {
+    os << "    " << record << ",\n";
+  }
+  os << "};\n";
+  os << "constexpr size_t MOVE_TABLE_SIZE = " << moves.size() << ";\n";
+  os << "}\n}\n";
+}
+}
+int main(int argc, char* argv[]) {
+  qvdraw::trace::init(argc, argv);
+  if (argc != 2) {
+    std::cerr << "qvmovegen moves.txt" << std::endl;
+    std::cerr << "Writes the compiled move table for the moves to stdout"
+              << std::endl;
+    return 1;
+  }
+  std::ifstream file(argv[1]);
+  if (!file) {
+    std::cerr << "Could not open " << argv[1] << std::endl;
+    return 1;
+  }
+  /* Only the name of the file goes in the output, so it does not depend on
+   * the path the moves were read from. */
+  const std::string path = argv[1];
+  const std::string name = path.substr(path.find_last_of('/') + 1);
+  try {
+    generate(std::cout, qvdraw::consts::read_moves(file), name);
+  } catch (const std::runtime_error& e) {
+    std::cerr << argv[1] << ": " << e.what() << std::endl;
+    return 1;
+  }
+  return 0;
+}
@@ -0,0 +1,372 @@
+/**
+ * raster.cc
+ * Copyright 2014-2015 John Lawson
+ *
+ * This program is free software: you can redistribute it and/or modify
+ * it under the terms of the GNU General Public License as published by
+ * the Free Software Foundation, either version 3 of the License, or
+ * (at your option) any later version.
+ *
+ * This program is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ * GNU General Public License for more details.
+ *
+ * You should have received a copy of the GNU General Public License
+ * along with this program.  If not, see <http://www.gnu.org/licenses/>.
+ */
+#include "raster.h"
+
+#include <algorithm>
+#include <array>
+#include <cmath>
+
+namespace qvdraw {
+namespace raster {
+namespace {
+const int GLYPH_WIDTH = 5;
+const int GLYPH_HEIGHT = 7;
+/* Each glyph is 7 rows of 5 bits, most significant bit on the left. */
+const uint8_t* glyph(char c) {
+  static const uint8_t digits[10][GLYPH_HEIGHT] = {
+      {0x0E, 0x11, 0x13, 0x15, 0x19, 0x11, 0x0E},
+      {0x04, 0x0C, 0x04, 0x04, 0x04, 0x04, 0x0E},
+      {0x0E, 0x11, 0x01, 0x02, 0x04, 0x08, 0x1F},
+      {0x1F, 0x02, 0x04, 0x02, 0x01, 0x11, 0x0E},
+      {0x02, 0x06, 0x0A, 0x12, 0x1F, 0x02, 0x02},
+      {0x1F, 0x10, 0x1E, 0x01, 0x01, 0x11, 0x0E},
+      {0x06, 0x08, 0x10, 0x1E, 0x11, 0x11, 0x0E},
+      {0x1F, 0x01, 0x02, 0x04, 0x08, 0x08, 0x08},
+      {0x0E, 0x11, 0x11, 0x0E, 0x11, 0x11, 0x0E},
+      {0x0E, 0x11, 0x11, 0x0F, 0x01, 0x02, 0x0C}};
+  static const uint8_t minus[GLYPH_HEIGHT] = {0, 0, 0, 0x1F, 0, 0, 0};
+  static const uint8_t plus[GLYPH_HEIGHT] = {0, 0x04, 0x04, 0x1F, 0x04, 0x04, 0};
+  static const uint8_t comma[GLYPH_HEIGHT] = {0, 0, 0, 0, 0x0C, 0x04, 0x08};
+  static const uint8_t point[GLYPH_HEIGHT] = {0, 0, 0, 0, 0, 0x0C, 0x0C};
+  if (c >= '0' && c <= '9') {
+    return digits[c - '0'];
+  }
+  switch (c) {
+    case '-':
+      return minus;
+    case '+':
+      return plus;
+    case ',':
+      return comma;
+    case '.':
+      return point;
+    default:
+      return nullptr;
+  }
+}
+double clamp01(double a) { return std::min(1.0, std::max(0.0, a)); }
+/* Distance from the point p to the segment a-b. */
+double segment_distance(double px, double py, double ax, double ay, double bx,
+                        double by) {
+  double dx = bx - ax;
+  double dy = by - ay;
+  double len2 = dx * dx + dy * dy;
+  double t = 0;
+  if (len2 > 0) {
+    t = clamp01(((px - ax) * dx + (py - ay) * dy) / len2);
+  }
+  double cx = ax + t * dx - px;
+  double cy = ay + t * dy - py;
+  return std::sqrt(cx * cx + cy * cy);
+}
+/* Signed distance from p to the line through a and b, positive on the left. */
+double edge_distance(double px, double py, double ax, double ay, double bx,
+                     double by) {
+  double dx = bx - ax;
+  double dy = by - ay;
+  double len = std::sqrt(dx * dx + dy * dy);
+  if (len == 0) {
+    return -1;
+  }
+  return ((px - ax) * dy - (py - ay) * dx) / len;
+}
+/*
+ * PNG encoding. The image data is compressed with a single deflate block
+ * using the fixed Huffman codes and a simple hash based match finder. This
+ * is far from optimal, but drawings are mostly background so it is plenty.
+ */
+class BitWriter {
+ public:
+  explicit BitWriter(std::vector<uint8_t>& out) : out_(out) {}
+  /* Write the lowest n bits of value, least significant bit first. */
+  void bits(uint32_t value, int n) {
+    for (int i = 0; i < n; ++i) {
+      put((value >> i) & 1);
+    }
+  }
+  /* Write a Huffman code of n bits, most significant bit first. */
+  void code(uint32_t value, int n) {
+    for (int i = n - 1; i >= 0; --i) {
+      put((value >> i) & 1);
+    }
+  }
+  void flush() {
+    if (count_ > 0) {
+      out_.push_back(current_);
+      current_ = 0;
+      count_ = 0;
+    }
+  }
+
+ private:
+  std::vector<uint8_t>& out_;
+  uint8_t current_ = 0;
+  int count_ = 0;
+
+  void put(uint32_t bit) {
+    current_ |= bit << count_;
+    if (++count_ == 8) {
+      flush();
+    }
+  }
+};
+const uint16_t LENGTH_BASE[] = {3,  4,  5,  6,   7,   8,   9,   10,  11, 13,
+                                15, 17, 19, 23,  27,  31,  35,  43,  51, 59,
+                                67, 83, 99, 115, 131, 163, 195, 227, 258};
+const uint8_t LENGTH_EXTRA[] = {0, 0, 0, 0, 0, 0, 0, 0, 1, 1, 1, 1, 2, 2, 2,
+                                2, 3, 3, 3, 3, 4, 4, 4, 4, 5, 5, 5, 5, 0};
+const uint16_t DIST_BASE[] = {1,    2,    3,    4,    5,    7,     9,    13,
+                              17,   25,   33,   49,   65,   97,    129,  193,
+                              257,  385,  513,  769,  1025, 1537,  2049, 3073,
+                              4097, 6145, 8193, 12289, 16385, 24577};
+const uint8_t DIST_EXTRA[] = {0, 0, 0, 0, 1, 1, 2, 2,  3,  3,  4,  4,  5,  5,  6,
+                              6, 7, 7, 8, 8, 9, 9, 10, 10, 11, 11, 12, 12, 13, 13};
+void literal(BitWriter& bw, int sym) {
+  if (sym < 144) {
+    bw.code(0x30 + sym, 8);
+  } else if (sym < 256) {
+    bw.code(0x190 + sym - 144, 9);
+  } else if (sym < 280) {
+    bw.code(sym - 256, 7);
+  } else {
+    bw.code(0xC0 + sym - 280, 8);
+  }
+}
+void match(BitWriter& bw, int length, int distance) {
+  int l = 28;
+  while (LENGTH_BASE[l] > length) {
+    --l;
+  }
+  literal(bw, 257 + l);
+  bw.bits(length - LENGTH_BASE[l], LENGTH_EXTRA[l]);
+  int d = 29;
+  while (DIST_BASE[d] > distance) {
+    --d;
+  }
+  bw.code(d, 5);
+  bw.bits(distance - DIST_BASE[d], DIST_EXTRA[d]);
+}
+std::vector<uint8_t> deflate(const std::vector<uint8_t>& data) {
+  const int WINDOW = 32768;
+  const int MAX_MATCH = 258;
+  const int HASH_BITS = 15;
+  std::vector<uint8_t> out;
+  out.push_back(0x78);
+  out.push_back(0x01);
+  BitWriter bw(out);
+  bw.bits(1, 1);  // Final block
+  bw.bits(1, 2);  // Fixed Huffman codes
+  std::vector<int> head(1 << HASH_BITS, -1);
+  const int size = data.size();
+  auto hash = [&data](int i) {
+    uint32_t h = (data[i] << 16) | (data[i + 1] << 8) | data[i + 2];
+    return (h * 2654435761u) >> (32 - HASH_BITS);
+  };
+  int i = 0;
+  while (i < size) {
+    int best = 0;
+    int dist = 0;
+    if (i + 2 < size) {
+      uint32_t h = hash(i);
+      int cand = head[h];
+      head[h] = i;
+      if (cand >= 0 && i - cand <= WINDOW) {
+        int max = std::min(MAX_MATCH, size - i);
+        int len = 0;
+        while (len < max && data[cand + len] == data[i + len]) {
+          ++len;
+        }
+        if (len >= 3) {
+          best = len;
+          dist = i - cand;
+        }
+      }
+    }
+    if (best > 0) {
+      match(bw, best, dist);
+      for (int j = i + 1; j < i + best && j + 2 < size; ++j) {
+        head[hash(j)] = j;
+      }
+      i += best;
+    } else {
+      literal(bw, data[i]);
+      ++i;
+    }
+  }
+  literal(bw, 256);
+  bw.flush();
+  uint32_t a = 1;
+  uint32_t b = 0;
+  for (uint8_t byte : data) {
+    a = (a + byte) % 65521;
+    b = (b + a) % 65521;
+  }
+  uint32_t adler = (b << 16) | a;
+  for (int shift = 24; shift >= 0; shift -= 8) {
+    out.push_back((adler >> shift) & 0xFF);
+  }
+  return out;
+}
+uint32_t crc(const uint8_t* data, size_t len, uint32_t c) {
+  static const std::array<uint32_t, 256> table = [] {
+    std::array<uint32_t, 256> t;
+    for (uint32_t n = 0; n < 256; ++n) {
+      uint32_t v = n;
+      for (int k = 0; k < 8; ++k) {
+        v = (v & 1) ? 0xEDB88320u ^ (v >> 1) : v >> 1;
+      }
+      t[n] = v;
+    }
+    return t;
+  }();
+  for (size_t n = 0; n < len; ++n) {
+    c = table[(c ^ data[n]) & 0xFF] ^ (c >> 8);
+  }
+  return c;
+}
+void put32(std::vector<uint8_t>& out, uint32_t v) {
+  for (int shift = 24; shift >= 0; shift -= 8) {
+    out.push_back((v >> shift) & 0xFF);
+  }
+}
+void chunk(std::ostream& os, const char* type, const std::vector<uint8_t>& data) {
+  std::vector<uint8_t> buf;
+  put32(buf, data.size());
+  buf.insert(buf.end(), type, type + 4);
+  buf.insert(buf.end(), data.begin(), data.end());
+  uint32_t c = crc(buf.data() + 4, buf.size() - 4, 0xFFFFFFFFu) ^ 0xFFFFFFFFu;
+  put32(buf, c);
+  os.write(reinterpret_cast<const char*>(buf.data()), buf.size());
+}
+}  // anonymous namespace
+Canvas::Canvas(int width, int height, Colour background)
+    : width_(width), height_(height), pixels_(3 * width * height) {
+  for (size_t i = 0; i < pixels_.size(); i += 3) {
+    pixels_[i] = background.r;
+    pixels_[i + 1] = background.g;
+    pixels_[i + 2] = background.b;
+  }
+}
+void Canvas::blend(int x, int y, double alpha, Colour colour) {
+  if (x < 0 || y < 0 || x >= width_ || y >= height_ || alpha <= 0) {
+    return;
+  }
+  alpha = clamp01(alpha);
+  uint8_t* p = &pixels_[3 * (y * width_ + x)];
+  p[0] = static_cast<uint8_t>(p[0] + alpha * (colour.r - p[0]) + 0.5);
+  p[1] = static_cast<uint8_t>(p[1] + alpha * (colour.g - p[1]) + 0.5);
+  p[2] = static_cast<uint8_t>(p[2] + alpha * (colour.b - p[2]) + 0.5);
+}
+void Canvas::line(double x0, double y0, double x1, double y1, double thickness,
+                  Colour colour) {
+  double r = thickness / 2;
+  int minx = std::floor(std::min(x0, x1) - r - 1);
+  int maxx = std::ceil(std::max(x0, x1) + r + 1);
+  int miny = std::floor(std::min(y0, y1) - r - 1);
+  int maxy = std::ceil(std::max(y0, y1) + r + 1);
+  for (int y = std::max(miny, 0); y <= std::min(maxy, height_ - 1); ++y) {
+    for (int x = std::max(minx, 0); x <= std::min(maxx, width_ - 1); ++x) {
+      double d = segment_distance(x + 0.5, y + 0.5, x0, y0, x1, y1);
+      blend(x, y, r + 0.5 - d, colour);
+    }
+  }
+}
+void Canvas::disc(double cx, double cy, double radius, Colour colour) {
+  int minx = std::floor(cx - radius - 1);
+  int maxx = std::ceil(cx + radius + 1);
+  int miny = std::floor(cy - radius - 1);
+  int maxy = std::ceil(cy + radius + 1);
+  for (int y = std::max(miny, 0); y <= std::min(maxy, height_ - 1); ++y) {
+    for (int x = std::max(minx, 0); x <= std::min(maxx, width_ - 1); ++x) {
+      double dx = x + 0.5 - cx;
+      double dy = y + 0.5 - cy;
+      blend(x, y, radius + 0.5 - std::sqrt(dx * dx + dy * dy), colour);
+    }
+  }
+}
+void Canvas::triangle(double x0, double y0, double x1, double y1, double x2,
+                      double y2, Colour colour) {
+  /* Orient the triangle so that the inside is to the left of each edge. */
+  if ((x1 - x0) * (y2 - y0) - (y1 - y0) * (x2 - x0) > 0) {
+    std::swap(x1, x2);
+    std::swap(y1, y2);
+  }
+  int minx = std::floor(std::min({x0, x1, x2}) - 1);
+  int maxx = std::ceil(std::max({x0, x1, x2}) + 1);
+  int miny = std::floor(std::min({y0, y1, y2}) - 1);
+  int maxy = std::ceil(std::max({y0, y1, y2}) + 1);
+  for (int y = std::max(miny, 0); y <= std::min(maxy, height_ - 1); ++y) {
+    for (int x = std::max(minx, 0); x <= std::min(maxx, width_ - 1); ++x) {
+      double px = x + 0.5;
+      double py = y + 0.5;
+      double d = std::min({edge_distance(px, py, x0, y0, x1, y1),
+                           edge_distance(px, py, x1, y1, x2, y2),
+                           edge_distance(px, py, x2, y2, x0, y0)});
+      blend(x, y, d + 0.5, colour);
+    }
+  }
+}
+void Canvas::text(double x, double y, const std::string& str, int scale,
+                  Colour colour) {
+  const int advance = (GLYPH_WIDTH + 1) * scale;
+  int left = std::lround(x - (advance * str.size() - scale) / 2.0);
+  int top = std::lround(y - GLYPH_HEIGHT * scale / 2.0);
+  for (char c : str) {
+    const uint8_t* rows = glyph(c);
+    if (rows != nullptr) {
+      for (int row = 0; row < GLYPH_HEIGHT; ++row) {
+        for (int col = 0; col < GLYPH_WIDTH; ++col) {
+          if (rows[row] & (1 << (GLYPH_WIDTH - 1 - col))) {
+            for (int dy = 0; dy < scale; ++dy) {
+              for (int dx = 0; dx < scale; ++dx) {
+                blend(left + col * scale + dx, top + row * scale + dy, 1,
+                      colour);
+              }
+            }
+          }
+        }
+      }
+    }
+    left += advance;
+  }
+}
+void Canvas::write_png(std::ostream& os) const {
+  static const uint8_t signature[] = {0x89, 'P',  'N',  'G',
+                                      '\r', '\n', 0x1A, '\n'};
+  os.write(reinterpret_cast<const char*>(signature), sizeof(signature));
+  std::vector<uint8_t> header;
+  put32(header, width_);
+  put32(header, height_);
+  header.push_back(8);  // Bit depth
+  header.push_back(2);  // Truecolour
+  header.push_back(0);  // Deflate
+  header.push_back(0);  // Adaptive filtering
+  header.push_back(0);  // No interlace
+  chunk(os, "IHDR", header);
+  std::vector<uint8_t> raw;
+  raw.reserve((3 * width_ + 1) * height_);
+  for (int y = 0; y < height_; ++y) {
+    raw.push_back(0);  // No filter
+    auto row = pixels_.begin() + 3 * y * width_;
+    raw.insert(raw.end(), row, row + 3 * width_);
+  }
+  chunk(os, "IDAT", deflate(raw));
+  chunk(os, "IEND", std::vector<uint8_t>());
+}
+}
+}
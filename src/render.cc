@@ -0,0 +1,292 @@
+/**
+ * render.cc
+ * Copyright 2014-2015 John Lawson
+ *
+ * This program is free software: you can redistribute it and/or modify
+ * it under the terms of the GNU General Public License as published by
+ * the Free Software Foundation, either version 3 of the License, or
+ * (at your option) any later version.
+ *
+ * This program is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ * GNU General Public License for more details.
+ *
+ * You should have received a copy of the GNU General Public License
+ * along with this program.  If not, see <http://www.gnu.org/licenses/>.
+ */
+#include "render.h"
+
+#include <algorithm>
+#include <cmath>
+#include <limits>
+#include <sstream>
+#include <stdexcept>
+
+#include "raster.h"
+#include "trace.h"
+
+namespace qvdraw {
+namespace render {
+namespace {
+/* Sizes of the parts of the picture, as a fraction of the node size. */
+const double NODE_RADIUS = 0.3;
+const double EDGE_WIDTH = 0.08;
+const double ARROW_LENGTH = 0.8;
+const double ARROW_WIDTH = 0.35;
+const double MARGIN = 1.5;
+const double LABEL_OFFSET = 0.6;
+/*
+ * Everything needed to draw an edge, in layout coordinates. The line is
+ * shortened so that it stops at the edge of the nodes, with room for the
+ * arrow head if there is one.
+ */
+struct EdgeShape {
+  double x0, y0, x1, y1;
+  double tip_x, tip_y;
+  double left_x, left_y, right_x, right_y;
+  double label_x, label_y;
+  std::string label;
+};
+struct Bounds {
+  double min_x = std::numeric_limits<double>::max();
+  double min_y = std::numeric_limits<double>::max();
+  double max_x = std::numeric_limits<double>::lowest();
+  double max_y = std::numeric_limits<double>::lowest();
+  double width() const { return max_x - min_x; }
+  double height() const { return max_y - min_y; }
+};
+/* Size used to scale all the parts of the picture. */
+double node_size(const ogdf::Graph& graph, const ogdf::GraphAttributes& attr) {
+  ogdf::node n = graph.firstNode();
+  if (n == nullptr || attr.width(n) <= 0) {
+    return 10;
+  }
+  return attr.width(n);
+}
+Bounds bounds(const ogdf::Graph& graph, const ogdf::GraphAttributes& attr,
+              double size) {
+  Bounds b;
+  ogdf::node n;
+  forall_nodes(n, graph) {
+    b.min_x = std::min(b.min_x, attr.x(n));
+    b.max_x = std::max(b.max_x, attr.x(n));
+    b.min_y = std::min(b.min_y, attr.y(n));
+    b.max_y = std::max(b.max_y, attr.y(n));
+  }
+  if (graph.numberOfNodes() == 0) {
+    b.min_x = b.min_y = b.max_x = b.max_y = 0;
+  }
+  double margin = MARGIN * size;
+  b.min_x -= margin;
+  b.min_y -= margin;
+  b.max_x += margin;
+  b.max_y += margin;
+  return b;
+}
+bool has_edge_labels(const ogdf::GraphAttributes& attr) {
+  return (attr.attributes() & ogdf::GraphAttributes::edgeLabel) != 0;
+}
+bool has_node_labels(const ogdf::GraphAttributes& attr) {
+  return (attr.attributes() & ogdf::GraphAttributes::nodeLabel) != 0;
+}
+template <class L>
+std::string to_string(const L& label) {
+  std::ostringstream ss;
+  ss << label;
+  return ss.str();
+}
+EdgeShape edge_shape(const ogdf::GraphAttributes& attr, ogdf::edge e,
+                     double size, const Style& style) {
+  EdgeShape s;
+  double sx = attr.x(e->source());
+  double sy = attr.y(e->source());
+  double tx = attr.x(e->target());
+  double ty = attr.y(e->target());
+  double dx = tx - sx;
+  double dy = ty - sy;
+  double len = std::sqrt(dx * dx + dy * dy);
+  double ux = len > 0 ? dx / len : 0;
+  double uy = len > 0 ? dy / len : 0;
+  double gap = 1.5 * NODE_RADIUS * size;
+  s.x0 = sx + gap * ux;
+  s.y0 = sy + gap * uy;
+  s.tip_x = tx - gap * ux;
+  s.tip_y = ty - gap * uy;
+  double head = style.arrows ? ARROW_LENGTH * size : 0;
+  s.x1 = s.tip_x - head * ux;
+  s.y1 = s.tip_y - head * uy;
+  double half = ARROW_WIDTH * size;
+  s.left_x = s.x1 - half * uy;
+  s.left_y = s.y1 + half * ux;
+  s.right_x = s.x1 + half * uy;
+  s.right_y = s.y1 - half * ux;
+  s.label_x = (sx + tx) / 2 + LABEL_OFFSET * size * uy;
+  s.label_y = (sy + ty) / 2 - LABEL_OFFSET * size * ux;
+  if (has_edge_labels(attr)) {
+    s.label = to_string(attr.labelEdge(e));
+  }
+  return s;
+}
+std::string escape(const std::string& str) {
+  std::string result;
+  for (char c : str) {
+    switch (c) {
+      case '&':
+        result += "&amp;";
+        break;
+      case '<':
+        result += "&lt;";
+        break;
+      case '>':
+        result += "&gt;";
+        break;
+      default:
+        result += c;
+    }
+  }
+  return result;
+}
+}  // anonymous namespace
+Format format(const std::string& name) {
+  if (name == "gml") {
+    return Format::GML;
+  } else if (name == "svg") {
+    return Format::SVG;
+  } else if (name == "png") {
+    return Format::PNG;
+  }
+  throw std::invalid_argument("Unknown picture format " + name);
+}
+std::string extension(Format format) {
+  switch (format) {
+    case Format::SVG:
+      return ".svg";
+    case Format::PNG:
+      return ".png";
+    case Format::GML:
+    default:
+      return ".gml";
+  }
+}
+void svg(std::ostream& os, const ogdf::Graph& graph,
+         const ogdf::GraphAttributes& attr, const Style& style) {
+  const double size = node_size(graph, attr);
+  const Bounds b = bounds(graph, attr, size);
+  const char nl = os.widen('\n');
+  /* Coordinates are written to two decimal places, leaving the stream as it
+   * was found afterwards. */
+  const std::ios::fmtflags flags = os.flags();
+  const std::streamsize precision = os.precision();
+  os.setf(std::ios::fixed, std::ios::floatfield);
+  os.precision(2);
+  os << "<?xml version=\"1.0\" encoding=\"UTF-8\"?>" << nl;
+  os << "<svg xmlns=\"http://www.w3.org/2000/svg\" width=\"" << b.width()
+     << "\" height=\"" << b.height() << "\" viewBox=\"" << b.min_x << " "
+     << b.min_y << " " << b.width() << " " << b.height() << "\">" << nl;
+  os << "<rect x=\"" << b.min_x << "\" y=\"" << b.min_y << "\" width=\""
+     << b.width() << "\" height=\"" << b.height() << "\" fill=\"white\"/>"
+     << nl;
+  os << "<g stroke=\"black\" stroke-width=\"" << EDGE_WIDTH * size << "\">"
+     << nl;
+  ogdf::edge e;
+  forall_edges(e, graph) {
+    EdgeShape s = edge_shape(attr, e, size, style);
+    os << "<line x1=\"" << s.x0 << "\" y1=\"" << s.y0 << "\" x2=\"" << s.x1
+       << "\" y2=\"" << s.y1 << "\"/>" << nl;
+    if (style.arrows) {
+      os << "<polygon stroke=\"none\" points=\"" << s.tip_x << "," << s.tip_y
+         << " " << s.left_x << "," << s.left_y << " " << s.right_x << ","
+         << s.right_y << "\"/>" << nl;
+    }
+  }
+  os << "</g>" << nl;
+  os << "<g fill=\"black\">" << nl;
+  ogdf::node n;
+  forall_nodes(n, graph) {
+    os << "<circle cx=\"" << attr.x(n) << "\" cy=\"" << attr.y(n)
+       << "\" r=\"" << NODE_RADIUS * size << "\"/>" << nl;
+  }
+  os << "</g>" << nl;
+  os << "<g font-family=\"sans-serif\" font-size=\"" << size
+     << "\" text-anchor=\"middle\" dominant-baseline=\"central\">" << nl;
+  forall_edges(e, graph) {
+    EdgeShape s = edge_shape(attr, e, size, style);
+    if (!s.label.empty()) {
+      os << "<text x=\"" << s.label_x << "\" y=\"" << s.label_y << "\">"
+         << escape(s.label) << "</text>" << nl;
+    }
+  }
+  if (has_node_labels(attr)) {
+    forall_nodes(n, graph) {
+      std::string label = to_string(attr.labelNode(n));
+      if (!label.empty()) {
+        os << "<text x=\"" << attr.x(n) << "\" y=\"" << attr.y(n) - size
+           << "\">" << escape(label) << "</text>" << nl;
+      }
+    }
+  }
+  os << "</g>" << nl;
+  os << "</svg>" << nl;
+  os.flags(flags);
+  os.precision(precision);
+}
+void png(std::ostream& os, const ogdf::Graph& graph,
+         const ogdf::GraphAttributes& attr, const Style& style) {
+  const double size = node_size(graph, attr);
+  const Bounds b = bounds(graph, attr, size);
+  const double scale = style.width / std::max(b.width(), b.height());
+  const int width = std::max(1L, std::lround(b.width() * scale));
+  const int height = std::max(1L, std::lround(b.height() * scale));
+  const raster::Colour black = {0, 0, 0};
+  raster::Canvas canvas(width, height);
+  auto px = [&b, scale](double x) { return (x - b.min_x) * scale; };
+  auto py = [&b, scale](double y) { return (y - b.min_y) * scale; };
+  const double thickness = std::max(1.0, EDGE_WIDTH * size * scale);
+  const int text_scale =
+      std::max(1L, std::lround(0.7 * size * scale / 7));
+  ogdf::edge e;
+  forall_edges(e, graph) {
+    EdgeShape s = edge_shape(attr, e, size, style);
+    canvas.line(px(s.x0), py(s.y0), px(s.x1), py(s.y1), thickness, black);
+    if (style.arrows) {
+      canvas.triangle(px(s.tip_x), py(s.tip_y), px(s.left_x), py(s.left_y),
+                      px(s.right_x), py(s.right_y), black);
+    }
+    if (!s.label.empty()) {
+      canvas.text(px(s.label_x), py(s.label_y), s.label, text_scale, black);
+    }
+  }
+  ogdf::node n;
+  forall_nodes(n, graph) {
+    canvas.disc(px(attr.x(n)), py(attr.y(n)), NODE_RADIUS * size * scale,
+                black);
+  }
+  if (has_node_labels(attr)) {
+    forall_nodes(n, graph) {
+      std::string label = to_string(attr.labelNode(n));
+      if (!label.empty()) {
+        canvas.text(px(attr.x(n)), py(attr.y(n) - size), label, text_scale,
+                    black);
+      }
+    }
+  }
+  canvas.write_png(os);
+}
+void write(Format format, std::ostream& os, const ogdf::Graph& graph,
+           const ogdf::GraphAttributes& attr, const Style& style) {
+  trace::Scope scope("render");
+  switch (format) {
+    case Format::SVG:
+      svg(os, graph, attr, style);
+      break;
+    case Format::PNG:
+      png(os, graph, attr, style);
+      break;
+    case Format::GML:
+      attr.writeGML(os);
+      break;
+  }
+}
+}
+}
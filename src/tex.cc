@@ -0,0 +1,219 @@
+/*
+ * tex.cc
+ * Copyright 2014-2015 John Lawson
+ *
+ * This program is free software: you can redistribute it and/or modify
+ * it under the terms of the GNU General Public License as published by
+ * the Free Software Foundation, either version 3 of the License, or
+ * (at your option) any later version.
+ *
+ * This program is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ * GNU General Public License for more details.
+ *
+ * You should have received a copy of the GNU General Public License
+ * along with this program.  If not, see <http://www.gnu.org/licenses/>.
+ */
+#include "tex.h"
+
+#include <algorithm>
+#include <cmath>
+#include <cstdio>
+#include <tuple>
+#include <unordered_map>
+
+namespace qv2tex {
+namespace {
+/* Larger numbers are written with printf, as they would overflow the integer
+ * used to hold the scaled value. */
+const double MAX_FIXED = 1e15;
+const char LETTERS[] = {'a', 'b', 'c', 'd', 'e', 'f', 'g', 'k', 'i', 'j'};
+
+long long power_of_ten(int exponent) {
+  long long result = 1;
+  for (int i = 0; i < exponent; ++i) {
+    result *= 10;
+  }
+  return result;
+}
+/* Write the digits of value to the end of the array, returning the first. */
+char* digits(unsigned long long value, char* end) {
+  do {
+    *--end = '0' + value % 10;
+    value /= 10;
+  } while (value > 0);
+  return end;
+}
+}
+TexBuffer::TexBuffer(std::ostream& os, size_t capacity)
+    : os_(&os), capacity_(capacity) {
+  buffer_.reserve(capacity + capacity / 4);
+}
+TexBuffer::TexBuffer() : os_(nullptr), capacity_(0) {}
+TexBuffer::~TexBuffer() {
+  flush();
+}
+TexBuffer& TexBuffer::operator<<(const char* str) {
+  buffer_.append(str);
+  check();
+  return *this;
+}
+TexBuffer& TexBuffer::operator<<(const std::string& str) {
+  buffer_.append(str);
+  check();
+  return *this;
+}
+TexBuffer& TexBuffer::operator<<(const ogdf::String& str) {
+  buffer_.append(str.cstr(), str.length());
+  check();
+  return *this;
+}
+TexBuffer& TexBuffer::operator<<(char c) {
+  buffer_.push_back(c);
+  return *this;
+}
+TexBuffer& TexBuffer::operator<<(int value) {
+  char str[24];
+  char* end = str + sizeof(str);
+  unsigned long long magnitude =
+      value < 0 ? -static_cast<long long>(value) : value;
+  char* start = digits(magnitude, end);
+  if (value < 0) {
+    *--start = '-';
+  }
+  buffer_.append(start, end);
+  return *this;
+}
+TexBuffer& TexBuffer::operator<<(size_t value) {
+  char str[24];
+  char* end = str + sizeof(str);
+  buffer_.append(digits(value, end), end);
+  return *this;
+}
+TexBuffer& TexBuffer::operator<<(double value) {
+  static const long long scale = power_of_ten(PRECISION);
+  if (!std::isfinite(value) || std::fabs(value) >= MAX_FIXED) {
+    char str[64];
+    int length = std::snprintf(str, sizeof(str), "%.*f", PRECISION, value);
+    buffer_.append(str, length);
+    return *this;
+  }
+  long long scaled = std::llround(value * scale);
+  if (scaled < 0) {
+    buffer_.push_back('-');
+    scaled = -scaled;
+  }
+  char str[40];
+  char* end = str + sizeof(str);
+  char* start = end;
+  long long fraction = scaled % scale;
+  for (int i = 0; i < PRECISION; ++i) {
+    *--start = '0' + fraction % 10;
+    fraction /= 10;
+  }
+  if (PRECISION > 0) {
+    *--start = '.';
+  }
+  start = digits(scaled / scale, start);
+  buffer_.append(start, end);
+  return *this;
+}
+TexBuffer& TexBuffer::letters(int value) {
+  /* Same order as int_to_str, least significant digit first. */
+  if (value == 0) {
+    buffer_.push_back(LETTERS[0]);
+  }
+  while (value > 0) {
+    buffer_.push_back(LETTERS[value % 10]);
+    value /= 10;
+  }
+  return *this;
+}
+void TexBuffer::flush() {
+  if (os_ != nullptr && !buffer_.empty()) {
+    os_->write(buffer_.data(), buffer_.size());
+    buffer_.clear();
+  }
+}
+std::string int_to_str(int a) {
+  std::string result;
+  if (a == 0) {
+    result += LETTERS[0];
+  }
+  while (a > 0) {
+    result += LETTERS[a % 10];
+    a = a / 10;
+  }
+  return result;
+}
+std::string glyph(const ogdf::Graph& graph,
+                  const ogdf::GraphAttributes& attr,
+                  const char* color) {
+  /* Vertices are compared by their position as written, so that two vertices
+   * which would be drawn in the same place are treated the same. */
+  struct Point {
+    std::string position;
+    std::string label;
+    ogdf::node node;
+  };
+  std::vector<Point> points;
+  ogdf::node n;
+  forall_nodes(n, graph) {
+    TexBuffer position;
+    position << attr.x(n) << ',' << attr.y(n);
+    points.push_back({position.str(), attr.labelNode(n).cstr(), n});
+  }
+  std::sort(points.begin(), points.end(), [](const Point& a, const Point& b) {
+    return std::tie(a.position, a.label) < std::tie(b.position, b.label);
+  });
+  std::unordered_map<ogdf::node, int> order;
+  for (size_t i = 0; i < points.size(); ++i) {
+    order[points[i].node] = i;
+  }
+  struct Arrow {
+    int source;
+    int target;
+    std::string label;
+  };
+  std::vector<Arrow> arrows;
+  ogdf::edge e;
+  forall_edges(e, graph) {
+    arrows.push_back({order[e->source()], order[e->target()],
+                      attr.labelEdge(e).cstr()});
+  }
+  std::sort(arrows.begin(), arrows.end(), [](const Arrow& a, const Arrow& b) {
+    return std::tie(a.source, a.target, a.label) <
+           std::tie(b.source, b.target, b.label);
+  });
+
+  TexBuffer out;
+  out << "\\begin{tikzpicture}[x=\\qvsize,y=\\qvsize]\n";
+  for (size_t i = 0; i < points.size(); ++i) {
+    out << "\\tkzDefPoint(" << points[i].position << "){n" << i << "}%\n";
+  }
+  for (const Arrow& arrow : arrows) {
+    out << "\\draw[->,shorten <=5,shorten >=5," << color << "] (n"
+        << arrow.source << ") -- (n" << arrow.target << ')';
+    if (!arrow.label.empty()) {
+      out << "node[midway,above,sloped] {$" << arrow.label << "$}";
+    }
+    out << ";\n";
+  }
+  out << "\\tkzDrawPoints[color=" << color << "](";
+  for (size_t i = 0; i < points.size(); ++i) {
+    out << (i > 0 ? ",n" : "n") << i;
+  }
+  out << ");\n";
+  for (size_t i = 0; i < points.size(); ++i) {
+    if (!points[i].label.empty()) {
+      out << "\\tkzLabelPoint[color=" << color << "](n" << i << "){$"
+          << points[i].label << "$}%\n";
+    }
+  }
+  out << "\\draw[" << color << "](current bounding box.south west)rectangle"
+                              "(current bounding box.north east);\n";
+  out << "\\end{tikzpicture}%\n";
+  return out.str();
+}
+}
@@ -0,0 +1,200 @@
+/*
+ * trace.cc
+ * Copyright 2014-2015 John Lawson
+ *
+ * This program is free software: you can redistribute it and/or modify
+ * it under the terms of the GNU General Public License as published by
+ * the Free Software Foundation, either version 3 of the License, or
+ * (at your option) any later version.
+ *
+ * This program is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ * GNU General Public License for more details.
+ *
+ * You should have received a copy of the GNU General Public License
+ * along with this program.  If not, see <http://www.gnu.org/licenses/>.
+ */
+#include "trace.h"
+
+#include <sys/resource.h>
+#include <unistd.h>
+
+#include <algorithm>
+#include <cstdlib>
+#include <cstring>
+#include <fstream>
+#include <map>
+#include <mutex>
+#include <streambuf>
+#include <string>
+#include <thread>
+#include <vector>
+
+namespace qvdraw {
+namespace trace {
+namespace detail {
+bool counting = false;
+bool tracing = false;
+std::atomic<size_t> counters[NUM_COUNTERS];
+}
+namespace {
+const char* const TRACE_OPTION = "--trace=";
+const char* const STATS_OPTION = "--stats";
+/* Names of the counters in the report, and in the trace with the spaces
+ * replaced. */
+const char* const NAMES[NUM_COUNTERS] = {
+    "nodes", "edges", "hash collisions", "equality calls", "layouts",
+    "refine iterations", "bytes written", "fingerprint matches",
+    "fingerprint false positives", "move checks", "moves pruned"};
+struct Event {
+  const char* name;
+  detail::Clock::time_point start;
+  detail::Clock::time_point end;
+  int thread;
+};
+struct State {
+  std::string program;
+  std::string path;
+  bool stats = false;
+  detail::Clock::time_point start;
+  std::mutex mutex;
+  std::vector<Event> events;
+  std::map<std::thread::id, int> threads;
+};
+State& state() {
+  static State state;
+  return state;
+}
+/* Passes everything on to the standard output, counting the bytes. */
+class CountingBuffer : public std::streambuf {
+ public:
+  explicit CountingBuffer(std::streambuf* out) : out_(out) {}
+  std::streambuf* out() const { return out_; }
+
+ protected:
+  int_type overflow(int_type c) override {
+    if (traits_type::eq_int_type(c, traits_type::eof())) {
+      return traits_type::not_eof(c);
+    }
+    count(BytesWritten);
+    return out_->sputc(traits_type::to_char_type(c));
+  }
+  std::streamsize xsputn(const char* s, std::streamsize n) override {
+    count(BytesWritten, n);
+    return out_->sputn(s, n);
+  }
+  int sync() override { return out_->pubsync(); }
+
+ private:
+  std::streambuf* const out_;
+};
+CountingBuffer* counting_buffer = nullptr;
+size_t peak_rss_kb() {
+  struct rusage usage;
+  if (getrusage(RUSAGE_SELF, &usage) != 0) {
+    return 0;
+  }
+  /* Kilobytes on Linux. */
+  return usage.ru_maxrss;
+}
+std::string json_string(const std::string& str) {
+  std::string result = "\"";
+  for (char c : str) {
+    if (c == '"' || c == '\\') {
+      result += '\\';
+    }
+    result += c;
+  }
+  return result + '"';
+}
+double micros(detail::Clock::time_point from, detail::Clock::time_point to) {
+  return std::chrono::duration<double, std::micro>(to - from).count();
+}
+void write_trace(State& s) {
+  std::ofstream os(s.path);
+  const int pid = getpid();
+  os << "{\"traceEvents\":[\n";
+  os << "{\"name\":\"process_name\",\"ph\":\"M\",\"pid\":" << pid
+     << ",\"tid\":0,\"args\":{\"name\":" << json_string(s.program) << "}}";
+  std::lock_guard<std::mutex> lock(s.mutex);
+  for (const Event& event : s.events) {
+    os << ",\n{\"name\":" << json_string(event.name)
+       << ",\"cat\":\"qvdraw\",\"ph\":\"X\",\"ts\":"
+       << micros(s.start, event.start)
+       << ",\"dur\":" << micros(event.start, event.end) << ",\"pid\":" << pid
+       << ",\"tid\":" << event.thread << '}';
+  }
+  os << ",\n{\"name\":\"counters\",\"ph\":\"C\",\"ts\":"
+     << micros(s.start, detail::Clock::now()) << ",\"pid\":" << pid
+     << ",\"tid\":0,\"args\":{";
+  for (int i = 0; i < NUM_COUNTERS; ++i) {
+    std::string name = NAMES[i];
+    std::replace(name.begin(), name.end(), ' ', '_');
+    os << json_string(name) << ':' << detail::counters[i].load() << ',';
+  }
+  os << "\"peak_rss_kb\":" << peak_rss_kb() << "}}\n]}\n";
+  if (!os) {
+    std::cerr << "Could not write trace " << s.path << std::cerr.widen('\n');
+  }
+}
+void finish() {
+  State& s = state();
+  std::cout.flush();
+  if (counting_buffer != nullptr) {
+    std::cout.rdbuf(counting_buffer->out());
+  }
+  if (!s.path.empty()) {
+    write_trace(s);
+  }
+  if (s.stats) {
+    report(std::cerr);
+  }
+}
+}
+void detail::record(const char* name, Clock::time_point start) {
+  const Clock::time_point end = Clock::now();
+  State& s = state();
+  std::lock_guard<std::mutex> lock(s.mutex);
+  auto thread =
+      s.threads.emplace(std::this_thread::get_id(), s.threads.size()).first;
+  s.events.push_back(Event{name, start, end, thread->second});
+}
+void init(int& argc, char* argv[]) {
+  State& s = state();
+  s.start = detail::Clock::now();
+  s.threads.emplace(std::this_thread::get_id(), 0);
+  s.program = argc > 0 ? argv[0] : "";
+  int kept = argc > 0 ? 1 : 0;
+  const size_t prefix = std::strlen(TRACE_OPTION);
+  for (int i = kept; i < argc; ++i) {
+    if (std::strncmp(argv[i], TRACE_OPTION, prefix) == 0) {
+      s.path = argv[i] + prefix;
+    } else if (std::strcmp(argv[i], STATS_OPTION) == 0) {
+      s.stats = true;
+    } else {
+      argv[kept++] = argv[i];
+    }
+  }
+  argc = kept;
+  argv[argc] = nullptr;
+  if (s.path.empty() && !s.stats) {
+    return;
+  }
+  detail::tracing = !s.path.empty();
+  detail::counting = true;
+  /* Never freed, as output can be written until the very end. */
+  counting_buffer = new CountingBuffer(std::cout.rdbuf());
+  std::cout.rdbuf(counting_buffer);
+  std::atexit(finish);
+}
+void report(std::ostream& os) {
+  os << "Stats:";
+  for (int i = 0; i < NUM_COUNTERS; ++i) {
+    os << (i == 0 ? " " : ", ") << NAMES[i] << ' '
+       << detail::counters[i].load();
+  }
+  os << ", peak RSS " << peak_rss_kb() << " KB" << os.widen('\n');
+}
+}
+}